@@ -0,0 +1,90 @@
+// SoftwareRenderer throughput benchmark
+//
+// Renders frames of translucent textured sprites headless, without a window or GPU,
+// and reports frame time and filled pixels per second.
+//
+// Usage: arclight-bench-software [sprite count] [sprite size in pixels] [output PNG]
+
+#include <Arclight/Core/ThreadPool.h>
+#include <Arclight/Core/Timer.h>
+#include <Arclight/Graphics/Rendering/Renderer.h>
+
+#include <Rendering/Software/SoftwareRenderer.h>
+
+#include <fmt/core.h>
+
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+using namespace Arclight;
+using namespace Arclight::Rendering;
+
+int main(int argc, char** argv) {
+    unsigned spriteCount = 10000;
+    if (argc > 1) {
+        spriteCount = std::strtoul(argv[1], nullptr, 10);
+    }
+
+    float spriteSize = 32.f;
+    if (argc > 2) {
+        spriteSize = std::strtof(argv[2], nullptr);
+    }
+
+    const Vector2i size = {1280, 720};
+    const int frames = 32;
+
+    ThreadPool pool;
+
+    SoftwareRenderer renderer;
+    renderer.initialize(nullptr);
+    renderer.resize_viewport(size);
+
+    // Checkerboard so texture fetches are not uniform
+    const unsigned textureSize = 64;
+    std::vector<uint32_t> pixels(textureSize * textureSize);
+    for (unsigned y = 0; y < textureSize; y++) {
+        for (unsigned x = 0; x < textureSize; x++) {
+            pixels[y * textureSize + x] = ((x / 8 + y / 8) % 2) ? 0xffffffff : 0xff4080c0;
+        }
+    }
+
+    Texture::TextureHandle texture =
+        renderer.allocate_texture({textureSize, textureSize}, Texture::Format_RGBA8_SRGB);
+    renderer.update_texture(texture, pixels.data());
+
+    std::vector<SpriteInstance> sprites;
+    sprites.reserve(spriteCount);
+    for (unsigned i = 0; i < spriteCount; i++) {
+        SpriteInstance sprite = SpriteInstance::create(
+            Rectf(Vector2f{0, 0}, Vector2f{spriteSize, spriteSize}), Affine2D(), 0,
+            Rectf(Vector2f{0, 0}, Vector2f{1, 1}), {1, 1, 1, 0.5f});
+        sprite.translation[0] = static_cast<float>((i * 37) % (size.x - 1));
+        sprite.translation[1] = static_cast<float>((i * 53) % (size.y - 1));
+        sprites.push_back(sprite);
+    }
+
+    fmt::print("{} sprites of {}x{} pixels, {}x{} framebuffer, {} threads, {} frames\n",
+               spriteCount, spriteSize, spriteSize, size.x, size.y, pool.thread_count(), frames);
+
+    const Matrix4 view;
+    Timer timer;
+    for (int i = 0; i < frames; i++) {
+        renderer.draw_instanced(sprites.data(), sprites.size(), view, texture,
+                                renderer.default_instanced_pipeline().handle());
+        renderer.render();
+    }
+
+    const double seconds = timer.elapsed() / 1000000.0;
+    // Sprites are clipped to the framebuffer, so this is the upper bound of filled pixels
+    const double pixelsPerFrame = static_cast<double>(spriteCount) * spriteSize * spriteSize;
+    fmt::print("{:.3f} ms/frame  {:.1f} Mpixels/s\n", seconds * 1000.0 / frames,
+               pixelsPerFrame * frames / seconds / 1000000.0);
+
+    if (argc > 3 && !renderer.save_png(argv[3])) {
+        fmt::print("Failed to save {}\n", argv[3]);
+    }
+
+    renderer.destroy_texture(texture);
+    return 0;
+}
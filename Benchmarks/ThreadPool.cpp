@@ -0,0 +1,228 @@
+// ThreadPool throughput benchmark
+//
+// Measures jobs/sec of the work stealing ThreadPool against
+// the previous single mutex + condition variable queue (LegacyThreadPool below).
+//
+// Usage: arclight-bench-threadpool [job count] [work iterations per job]
+
+#include <Arclight/Core/Job.h>
+#include <Arclight/Core/ThreadPool.h>
+#include <Arclight/Core/Timer.h>
+
+#include <fmt/core.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdlib>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+using namespace Arclight;
+
+// Copy of the ThreadPool as it was before work stealing, kept as the baseline
+class LegacyThreadPool final {
+public:
+    LegacyThreadPool(unsigned threadCount) {
+        while (threadCount--) {
+            m_threads.push_back(std::thread(&LegacyThreadPool::thread_main, this));
+        }
+    }
+
+    ~LegacyThreadPool() {
+        {
+            std::scoped_lock lock(m_queueMutex);
+            m_threadsShouldDie = true;
+        }
+
+        m_condition.notify_all();
+        for (auto& thread : m_threads) {
+            thread.join();
+        }
+    }
+
+    void Schedule(Job& job) {
+        std::scoped_lock lock(m_queueMutex);
+
+        m_jobCount++;
+        m_jobs.push(&job);
+        m_condition.notify_one();
+    }
+
+    void run() {
+        Job* currentJob = nullptr;
+        while (!m_threadsShouldDie) {
+            {
+                std::scoped_lock lock(m_queueMutex);
+                if (m_jobs.empty()) {
+                    break;
+                }
+
+                currentJob = m_jobs.front();
+                m_jobs.pop();
+            }
+
+            currentJob->run();
+            m_jobCount--;
+        }
+    }
+
+    unsigned thread_count() const { return m_threads.size(); }
+    unsigned job_count() const { return m_jobCount; }
+
+private:
+    void thread_main() {
+        Job* currentJob = nullptr;
+        while (true) {
+            {
+                std::unique_lock<std::mutex> acquiredLock(m_queueMutex);
+                m_condition.wait(acquiredLock,
+                                 [this]() -> bool { return !m_jobs.empty() || m_threadsShouldDie; });
+
+                if (m_threadsShouldDie) {
+                    return;
+                }
+
+                currentJob = m_jobs.front();
+                m_jobs.pop();
+            }
+
+            currentJob->run();
+            m_jobCount--;
+        }
+    }
+
+    bool m_threadsShouldDie = false;
+
+    std::vector<std::thread> m_threads;
+
+    std::atomic<unsigned> m_jobCount = 0;
+    std::queue<Job*> m_jobs;
+    std::condition_variable m_condition;
+    std::mutex m_queueMutex;
+};
+
+// Application::process_job_queue equivalent for each pool
+static void wait_for_jobs(ThreadPool& pool) { pool.wait_idle(); }
+
+static void wait_for_jobs(LegacyThreadPool& pool) {
+    pool.run();
+    while (pool.job_count())
+        ;
+}
+
+static unsigned s_workIterations = 64;
+
+// Small amount of integer work so the scheduler overhead dominates
+class WorkJob final : public Job {
+public:
+    void run() override {
+        uint32_t value = m_seed;
+        for (unsigned i = 0; i < s_workIterations; i++) {
+            value ^= value << 13;
+            value ^= value >> 17;
+            value ^= value << 5;
+        }
+
+        m_seed = value;
+    }
+
+private:
+    uint32_t m_seed = 0x9E3779B9;
+};
+
+// Schedules children from inside the pool, exercises worker local queues and stealing
+template <typename Pool> class SpawnJob final : public Job {
+public:
+    void setup(Pool* pool, WorkJob* children, unsigned childCount) {
+        m_pool = pool;
+        m_children = children;
+        m_childCount = childCount;
+    }
+
+    void run() override {
+        for (unsigned i = 0; i < m_childCount; i++) {
+            m_pool->Schedule(m_children[i]);
+        }
+    }
+
+private:
+    Pool* m_pool = nullptr;
+    WorkJob* m_children = nullptr;
+    unsigned m_childCount = 0;
+};
+
+template <typename Pool> static double bench_flat(Pool& pool, std::vector<WorkJob>& jobs) {
+    Timer timer;
+    for (WorkJob& job : jobs) {
+        pool.Schedule(job);
+    }
+
+    wait_for_jobs(pool);
+
+    long us = timer.elapsed();
+    return jobs.size() / (us / 1000000.0);
+}
+
+template <typename Pool> static double bench_spawn(Pool& pool, std::vector<WorkJob>& jobs) {
+    const unsigned childCount = 64;
+    const unsigned spawnerCount = jobs.size() / childCount;
+
+    std::vector<SpawnJob<Pool>> spawners(spawnerCount);
+    for (unsigned i = 0; i < spawnerCount; i++) {
+        spawners[i].setup(&pool, jobs.data() + i * childCount, childCount);
+    }
+
+    Timer timer;
+    for (auto& spawner : spawners) {
+        pool.Schedule(spawner);
+    }
+
+    wait_for_jobs(pool);
+
+    long us = timer.elapsed();
+    return (spawnerCount * (childCount + 1)) / (us / 1000000.0);
+}
+
+template <typename Pool>
+static void report(const char* name, Pool& pool, std::vector<WorkJob>& jobs, int rounds) {
+    double flat = 0, spawn = 0;
+    for (int i = 0; i < rounds; i++) {
+        flat += bench_flat(pool, jobs);
+        spawn += bench_spawn(pool, jobs);
+    }
+
+    fmt::print("{:<12} {:>3} threads  flat: {:>12.0f} jobs/s  spawn: {:>12.0f} jobs/s\n", name,
+               pool.thread_count(), flat / rounds, spawn / rounds);
+}
+
+int main(int argc, char** argv) {
+    unsigned jobCount = 1 << 18;
+    if (argc > 1) {
+        jobCount = std::strtoul(argv[1], nullptr, 10);
+    }
+
+    if (argc > 2) {
+        s_workIterations = std::strtoul(argv[2], nullptr, 10);
+    }
+
+    const int rounds = 8;
+    std::vector<WorkJob> jobs(jobCount);
+
+    fmt::print("{} jobs, {} work iterations per job, {} rounds\n", jobCount, s_workIterations,
+               rounds);
+
+    {
+        ThreadPool pool;
+        report("WorkStealing", pool, jobs, rounds);
+    }
+
+    {
+        unsigned threadCount = std::thread::hardware_concurrency();
+        LegacyThreadPool pool(threadCount > 1 ? threadCount - 1 : 0);
+        report("Legacy", pool, jobs, rounds);
+    }
+
+    return 0;
+}
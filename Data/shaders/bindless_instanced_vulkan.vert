@@ -0,0 +1,31 @@
+#version 450
+
+layout(push_constant) uniform Transform {
+    mat4 viewport;
+    mat4 canvas;
+    mat4 transform; // Unused, each instance has its own transform
+    uint textureIndex; // Texture of the draw, 0xFFFFFFFF to use the texture of each instance
+};
+
+layout(location = 0) in vec2 position; // Unit quad
+
+// Per instance
+layout(location = 1) in vec4 instanceTransform; // a, b, c, d
+layout(location = 2) in vec3 instanceTranslation; // tx, ty, z index
+layout(location = 3) in vec4 instanceColour;
+layout(location = 4) in vec4 instanceUVRect; // left, top, right, bottom
+layout(location = 5) in uint instanceTextureIndex;
+
+layout(location = 0) out vec4 fragColour;
+layout(location = 1) out vec2 fragTexCoord;
+layout(location = 2) flat out uint fragTextureIndex;
+
+void main() {
+    vec2 world = instanceTransform.xy * position.x + instanceTransform.zw * position.y +
+                 instanceTranslation.xy;
+
+    gl_Position = viewport * canvas * vec4(world, instanceTranslation.z, 1.0);
+    fragColour = instanceColour;
+    fragTexCoord = mix(instanceUVRect.xy, instanceUVRect.zw, position);
+    fragTextureIndex = textureIndex == 0xFFFFFFFFu ? instanceTextureIndex : textureIndex;
+}
@@ -0,0 +1,20 @@
+#version 450
+#extension GL_EXT_nonuniform_qualifier : require
+
+layout(binding = 1) uniform sampler2D textures[]; // Bindless texture table of signed distance fields
+
+layout(location = 0) in vec4 fragColour; // Fragment colour
+layout(location = 1) in vec2 fragTexCoord; // Texture coordinate
+layout(location = 2) flat in uint fragTextureIndex; // May differ between instances of a draw
+
+layout(location = 0) out vec4 outColour; // Output colour
+
+void main() {
+    // A8 textures hold their texels in alpha, red reads as one
+    float distance = texture(textures[nonuniformEXT(fragTextureIndex)], fragTexCoord).a;
+    // Antialias over one screen pixel whatever the scale of the text
+    float width = fwidth(distance);
+    float alpha = smoothstep(0.5 - width, 0.5 + width, distance);
+
+    outColour = vec4(fragColour.rgb, fragColour.a * alpha);
+}
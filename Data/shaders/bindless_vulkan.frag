@@ -0,0 +1,14 @@
+#version 450
+#extension GL_EXT_nonuniform_qualifier : require
+
+layout(binding = 1) uniform sampler2D textures[]; // Bindless texture table
+
+layout(location = 0) in vec4 fragColour; // Fragment colour
+layout(location = 1) in vec2 fragTexCoord; // Texture coordinate
+layout(location = 2) flat in uint fragTextureIndex; // May differ between instances of a draw
+
+layout(location = 0) out vec4 outColour; // Output colour
+
+void main() {
+    outColour = fragColour * texture(textures[nonuniformEXT(fragTextureIndex)], fragTexCoord);
+}
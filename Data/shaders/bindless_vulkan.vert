@@ -0,0 +1,23 @@
+#version 450
+
+layout(push_constant) uniform Transform {
+    mat4 viewport;
+    mat4 canvas;
+    mat4 transform;
+    uint textureIndex; // Index of the texture in the bindless texture table
+};
+
+layout(location = 0) in vec2 position;
+layout(location = 1) in vec2 texCoord;
+layout(location = 2) in vec4 colour;
+
+layout(location = 0) out vec4 fragColour;
+layout(location = 1) out vec2 fragTexCoord;
+layout(location = 2) flat out uint fragTextureIndex;
+
+void main() {
+    gl_Position = viewport * canvas * transform * vec4(position, 0.0, 1.0);
+    fragColour = colour;
+    fragTexCoord = texCoord;
+    fragTextureIndex = textureIndex;
+}
@@ -0,0 +1,28 @@
+#version 300 es
+
+precision highp float;
+
+uniform Transform {
+    mat4 viewport;
+};
+uniform mat4 canvas;
+
+layout(location = 0) in vec2 position; // Unit quad
+
+// Per instance
+layout(location = 1) in vec4 instanceTransform; // a, b, c, d
+layout(location = 2) in vec3 instanceTranslation; // tx, ty, z index
+layout(location = 3) in vec4 instanceColour;
+layout(location = 4) in vec4 instanceUVRect; // left, top, right, bottom
+
+out vec4 fragColour;
+out vec2 fragTexCoord;
+
+void main() {
+    vec2 world = instanceTransform.xy * position.x + instanceTransform.zw * position.y +
+                 instanceTranslation.xy;
+
+    gl_Position = viewport * canvas * vec4(world, instanceTranslation.z, 1.0);
+    fragColour = instanceColour;
+    fragTexCoord = mix(instanceUVRect.xy, instanceUVRect.zw, position);
+}
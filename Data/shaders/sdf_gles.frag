@@ -0,0 +1,19 @@
+#version 300 es
+
+precision mediump float;
+
+uniform sampler2D texSampler; // Signed distance field, 0.5 on the outline and larger inside
+
+in vec4 fragColour; // Fragment colour
+in vec2 fragTexCoord; // Texture coordinate
+
+out vec4 outColour; // Output colour
+
+void main() {
+    float distance = texture(texSampler, fragTexCoord).x;
+    // Antialias over one screen pixel whatever the scale of the text
+    float width = fwidth(distance);
+    float alpha = smoothstep(0.5 - width, 0.5 + width, distance);
+
+    outColour = vec4(fragColour.rgb, fragColour.a * alpha);
+}
@@ -0,0 +1,19 @@
+#version 450
+#extension GL_ARB_separate_shader_objects : enable
+
+layout(binding = 1) uniform sampler2D texSampler; // Signed distance field, 0.5 on the outline and larger inside
+
+layout(location = 0) in vec4 fragColour; // Fragment colour
+layout(location = 1) in vec2 fragTexCoord; // Texture coordinate
+
+layout(location = 0) out vec4 outColour; // Output colour
+
+void main() {
+    // A8 textures hold their texels in alpha, red reads as one
+    float distance = texture(texSampler, fragTexCoord).a;
+    // Antialias over one screen pixel whatever the scale of the text
+    float width = fwidth(distance);
+    float alpha = smoothstep(0.5 - width, 0.5 + width, distance);
+
+    outColour = vec4(fragColour.rgb, fragColour.a * alpha);
+}
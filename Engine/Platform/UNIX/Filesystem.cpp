@@ -102,6 +102,13 @@ bool _Access(const UnicodeString& upath, int mode) {
     return true;
 }
 
+bool _Exists(const UnicodeString& upath) {
+    std::string path;
+    upath.toUTF8String<std::string>(path);
+
+    return access(path.c_str(), F_OK) == 0;
+}
+
 File* _OpenFile(const UnicodeString& upath, int mode, Error* e) {
     std::string path;
     upath.toUTF8String<std::string>(path);
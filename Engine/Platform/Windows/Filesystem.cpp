@@ -74,6 +74,13 @@ bool _Access(const UnicodeString& upath, int mode) {
     return true;
 }
 
+bool _Exists(const UnicodeString& upath) {
+    UnicodeString pathCopy = upath;
+    const wchar_t* path = as_wide_string(pathCopy);
+
+    return GetFileAttributesW(path) != INVALID_FILE_ATTRIBUTES;
+}
+
 File* _OpenFile(const UnicodeString& upath, int mode, Error* e) {
     static_assert(sizeof(wchar_t) == sizeof(char16_t));
     UnicodeString pathCopy = upath;
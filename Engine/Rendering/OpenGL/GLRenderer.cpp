@@ -6,7 +6,9 @@
 #include <Arclight/Platform/Platform.h>
 #include <Arclight/Window/WindowContext.h>
 
+#include <algorithm>
 #include <cassert>
+#include <vector>
 
 #include <SDL2/SDL_opengles2.h>
 
@@ -22,16 +24,19 @@
 namespace Arclight::Rendering {
 
 GLRenderer::~GLRenderer() {
-    for (auto* p : m_pipelines) {
-        delete p;
+    m_pipelines.for_each([](GLPipeline* p) { delete p; });
+    m_textures.for_each([](GLTexture* t) { delete t; });
+
+    if (m_quadIndexBuffer) {
+        glDeleteBuffers(1, &m_quadIndexBuffer);
     }
 
-    for (auto* t : m_textures) {
-        delete t;
+    if (m_unitQuadBuffer) {
+        glDeleteBuffers(1, &m_unitQuadBuffer);
+        glDeleteBuffers(1, &m_instanceBuffer);
     }
 
-    m_pipelines.clear();
-    m_textures.clear();
+    m_transientChain.destroy(*this);
 
     SDL_GL_DeleteContext(m_glContext);
 }
@@ -115,6 +120,30 @@ int GLRenderer::initialize(class WindowContext* context) {
         Shader fragShader(Shader::FragmentShader, defaultFragmentShaderData);
 
         m_defaultPipeline = std::make_unique<RenderPipeline>(vertShader, fragShader);
+
+        Shader instancedVertShader(Shader::VertexShader, defaultInstancedVertexShaderData);
+        RenderPipeline::PipelineFixedConfig instancedConfig = RenderPipeline::defaultConfig;
+        instancedConfig.vertexLayout = RenderPipeline::VertexLayoutSpriteInstance;
+
+        m_defaultInstancedPipeline =
+            std::make_unique<RenderPipeline>(instancedVertShader, fragShader, instancedConfig);
+
+        Shader sdfFragShader(Shader::FragmentShader, defaultSDFFragmentShaderData);
+
+        m_defaultSDFPipeline = std::make_unique<RenderPipeline>(vertShader, sdfFragShader);
+        m_defaultSDFInstancedPipeline =
+            std::make_unique<RenderPipeline>(instancedVertShader, sdfFragShader, instancedConfig);
+    }
+
+    {
+        // Bottom left, top left, bottom right, top right like Sprite::vertices
+        const float unitQuad[] = {0.f, 1.f, 0.f, 0.f, 1.f, 1.f, 1.f, 0.f};
+
+        glCheck(glGenBuffers(1, &m_unitQuadBuffer));
+        glCheck(glBindBuffer(GL_ARRAY_BUFFER, m_unitQuadBuffer));
+        glCheck(glBufferData(GL_ARRAY_BUFFER, sizeof(unitQuad), unitQuad, GL_STATIC_DRAW));
+
+        glCheck(glGenBuffers(1, &m_instanceBuffer));
     }
 
     auto& clearColour = context->backgroundColour;
@@ -132,7 +161,12 @@ void GLRenderer::render() {
     clear();
 
     m_boundVBO = 0;
+    upload_transient();
     Renderer::render();
+    {
+        std::scoped_lock lockTransient(m_transientLock);
+        m_transientChain.reset(*this);
+    }
 
     SDL_GL_SwapWindow(m_windowContext->GetWindow());
 
@@ -165,19 +199,25 @@ GLRenderer::create_pipeline(const Shader& vertexShader, const Shader& fragmentSh
 
     GLPipeline* pipeline = new GLPipeline(vertexShader, fragmentShader);
 
-    m_pipelines.insert(pipeline);
-    return pipeline;
+    return m_pipelines.insert(pipeline);
 }
 
 void GLRenderer::destroy_pipeline(RenderPipeline::PipelineHandle pipelineHandle) {
     std::unique_lock lockGL(m_glMutex);
     die_if_not_gl_thread();
 
-    size_t erased = m_pipelines.erase(reinterpret_cast<GLPipeline*>(pipelineHandle));
-    assert(erased ==
-           1); // Erase returns the amount of pipelines erased, ensure that this is exactly 1
+    GLPipeline* pipeline = m_pipelines.erase(pipelineHandle);
+    if (!pipeline) {
+        Logger::Warning("GLRenderer: Invalid pipeline handle {}.", pipelineHandle);
+        return;
+    }
+
+    if (m_boundPipeline == pipeline) {
+        m_boundPipeline = nullptr;
+        m_lastProgram = 0;
+    }
 
-    delete reinterpret_cast<GLPipeline*>(pipelineHandle);
+    delete pipeline;
 }
 
 RenderPipeline& GLRenderer::default_pipeline() {
@@ -186,21 +226,33 @@ RenderPipeline& GLRenderer::default_pipeline() {
 }
 
 void GLRenderer::bind_pipeline(RenderPipeline::PipelineHandle pipeline) {
-    m_boundPipeline = reinterpret_cast<GLPipeline*>(pipeline);
+    GLPipeline* glPipeline = m_pipelines.get(pipeline);
+    if (!glPipeline) {
+        Logger::Warning("GLRenderer: Invalid pipeline handle {}.", pipeline);
+        return;
+    }
+
+    m_boundPipeline = glPipeline;
     if (m_boundPipeline->GetGLProgram() != m_lastProgram) {
         glCheck(glUseProgram(m_boundPipeline->GetGLProgram()));
 
         m_lastProgram = m_boundPipeline->GetGLProgram();
+        // textureFormat is a uniform of the program, set it again on the next bind_texture
+        m_boundTexture = nullptr;
     }
 }
 
 void GLRenderer::bind_texture(Texture::TextureHandle texture) {
-    if(texture == m_boundTexture) {
+    GLTexture* tex = m_textures.get(texture);
+    if (texture && !tex) {
+        Logger::Warning("GLRenderer: Invalid texture handle {}.", texture);
+    }
+
+    if(tex == m_boundTexture) {
         return;
     }
 
-    if (texture) {
-        GLTexture* tex = reinterpret_cast<GLTexture*>(texture);
+    if (tex) {
         glActiveTexture(GL_TEXTURE0);
         glCheck(glBindTexture(GL_TEXTURE_2D, tex->id));
 
@@ -213,11 +265,20 @@ void GLRenderer::bind_texture(Texture::TextureHandle texture) {
         glBindTexture(GL_TEXTURE_2D, 0);
     }
 
-    m_boundTexture = (GLTexture*)texture;
+    m_boundTexture = tex;
 }
 
 void GLRenderer::bind_vertex_buffer(void* buffer) {
-    GLVertexBuffer* vbo = (GLVertexBuffer*)buffer;
+    GLVertexBuffer* vbo = m_vbos.get(buffer);
+    if (!vbo) {
+        vbo = m_transientBuffers.get(buffer);
+    }
+
+    if (!vbo) {
+        Logger::Warning("GLRenderer: Invalid vertex buffer handle {}.", buffer);
+        m_boundVBO = 0;
+        return;
+    }
 
     m_boundVBO = vbo->id;
 }
@@ -237,14 +298,16 @@ void* GLRenderer::allocate_vertex_buffer(unsigned vertexCount) {
     vbo->id = id;
     vbo->vertexCount = vertexCount;
 
-    m_vbos.insert(vbo);
-
-    return (void*)vbo;
+    return m_vbos.insert(vbo);
 }
 
 void GLRenderer::update_vertex_buffer(void* buffer, unsigned int offset, unsigned int size,
                                       const Vertex* vertices) {
-    GLVertexBuffer* vbo = (GLVertexBuffer*)buffer;
+    GLVertexBuffer* vbo = m_vbos.get(buffer);
+    if (!vbo) {
+        Logger::Warning("GLRenderer: Invalid vertex buffer handle {}.", buffer);
+        return;
+    }
 
     std::unique_lock lockGL(m_glMutex);
     acquire_stream_context_if_necessary();
@@ -260,40 +323,183 @@ void GLRenderer::destroy_vertex_buffer(void* buffer) {
     std::unique_lock lockGL(m_glMutex);
     acquire_stream_context_if_necessary();
 
-    GLVertexBuffer* vbo = (GLVertexBuffer*)buffer;
-
-    size_t erased = m_vbos.erase(vbo);
-    assert(erased ==
-           1); // Erase returns the amount of pipelines erased, ensure that this is exactly 1
+    GLVertexBuffer* vbo = m_vbos.erase(buffer);
+    if (!vbo) {
+        Logger::Warning("GLRenderer: Invalid vertex buffer handle {}.", buffer);
+        return;
+    }
 
     glDeleteBuffers(1, &vbo->id);
 
     delete vbo;
 }
 
+Renderer::TransientAllocation GLRenderer::allocate_transient(size_t size) {
+    std::unique_lock lockTransient(m_transientLock);
+    return m_transientChain.allocate(*this, size);
+}
+
+Renderer::TransientBlock GLRenderer::create_transient_block(size_t size) {
+    GLTransientBlock* glBlock = new GLTransientBlock{
+        .buffer = {0, static_cast<unsigned>(size / sizeof(Vertex))},
+        .data = std::make_unique<uint8_t[]>(size),
+    };
+
+    return {glBlock->data.get(), size, 0, m_transientBuffers.insert(&glBlock->buffer), glBlock};
+}
+
+void GLRenderer::destroy_transient_block(const TransientBlock& block) {
+    GLTransientBlock* glBlock = static_cast<GLTransientBlock*>(block.backend);
+    if (glBlock->buffer.id) {
+        glDeleteBuffers(1, &glBlock->buffer.id);
+    }
+
+    m_transientBuffers.erase(block.vertexBuffer);
+    delete glBlock;
+}
+
+void GLRenderer::upload_transient() {
+    for (const TransientBlock& block : m_transientChain.blocks()) {
+        if (!block.used) {
+            continue;
+        }
+
+        GLVertexBuffer& buffer = static_cast<GLTransientBlock*>(block.backend)->buffer;
+        if (!buffer.id) {
+            glCheck(glGenBuffers(1, &buffer.id));
+        }
+
+        // Orphan the buffer so the driver does not wait for the last frame to finish with it
+        glCheck(glBindBuffer(GL_ARRAY_BUFFER, buffer.id));
+        glCheck(glBufferData(GL_ARRAY_BUFFER, block.size, nullptr, GL_STREAM_DRAW));
+        glCheck(glBufferSubData(GL_ARRAY_BUFFER, 0, block.used, block.data));
+    }
+}
+
 void GLRenderer::do_draw_call(unsigned firstVertex, unsigned vertexCount, const Matrix4& transform,
                               const Matrix4& view) {
     auto vbo = GetVertexBufferObject(vertexCount);
 
+    prepare_draw(0, transform, view);
+
+    glDrawArrays(GL_TRIANGLE_STRIP, firstVertex, vertexCount);
+}
+
+void GLRenderer::do_draw_indexed_call(unsigned firstVertex, unsigned indexCount,
+                                      const Matrix4& transform, const Matrix4& view) {
+    reserve_quad_indices(indexCount / 6);
+
+    prepare_draw(firstVertex, transform, view);
+
+    // Element array binding is part of the VAO state
+    glCheck(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_quadIndexBuffer));
+    glDrawElements(GL_TRIANGLES, indexCount, GL_UNSIGNED_INT, nullptr);
+}
+
+void GLRenderer::upload_instances(const SpriteInstance* instances, unsigned instanceCount) {
+    glCheck(glBindBuffer(GL_ARRAY_BUFFER, m_instanceBuffer));
+
+    // Orphan the buffer so the driver does not wait for the last frame to finish with it
+    m_instanceCapacity = std::max(instanceCount, m_instanceCapacity);
+    glCheck(glBufferData(GL_ARRAY_BUFFER, m_instanceCapacity * sizeof(SpriteInstance), nullptr,
+                         GL_STREAM_DRAW));
+    glCheck(glBufferSubData(GL_ARRAY_BUFFER, 0, instanceCount * sizeof(SpriteInstance),
+                            instances));
+}
+
+void GLRenderer::do_draw_instanced_call(unsigned firstInstance, unsigned instanceCount,
+                                        const Matrix4& view) {
+    // OpenGL ES has no base instance, instance attributes start at firstInstance
+    const size_t base = firstInstance * sizeof(SpriteInstance);
+
+    glBindVertexArray(m_boundPipeline->GetVAO());
+
+    glCheck(glBindBuffer(GL_ARRAY_BUFFER, m_unitQuadBuffer));
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), nullptr);
+    glEnableVertexAttribArray(0);
+
+    glCheck(glBindBuffer(GL_ARRAY_BUFFER, m_instanceBuffer));
+    // Transform
+    glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, sizeof(SpriteInstance),
+                          (const void*)(base + offsetof(SpriteInstance, transform)));
+    // Translation and z index
+    glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, sizeof(SpriteInstance),
+                          (const void*)(base + offsetof(SpriteInstance, translation)));
+    // Packed colour
+    glVertexAttribPointer(3, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(SpriteInstance),
+                          (const void*)(base + offsetof(SpriteInstance, colour)));
+    // Texture coordinates
+    glVertexAttribPointer(4, 4, GL_FLOAT, GL_FALSE, sizeof(SpriteInstance),
+                          (const void*)(base + offsetof(SpriteInstance, uvRect)));
+
+    for (GLuint attrib = 1; attrib <= 4; attrib++) {
+        glEnableVertexAttribArray(attrib);
+        // Divisor is part of the VAO, which belongs to the instanced pipeline
+        glVertexAttribDivisor(attrib, 1);
+    }
+
+    glUniformMatrix4fv(m_boundPipeline->CanvasTransformIndex(), 1, GL_FALSE, view.matrix());
+
+    glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, instanceCount);
+}
+
+void GLRenderer::prepare_draw(unsigned firstVertex, const Matrix4& transform,
+                              const Matrix4& view) {
+    const size_t base = firstVertex * sizeof(Vertex);
+
     glBindVertexArray(m_boundPipeline->GetVAO());
     glCheck(glBindBuffer(GL_ARRAY_BUFFER, m_boundVBO));
 
     // Position
-    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), NULL);
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex),
+                          (const void*)(base + offsetof(Vertex, position)));
     glEnableVertexAttribArray(0);
     // Texture Coordinates
     glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex),
-                          (const void*)offsetof(Vertex, texCoord));
+                          (const void*)(base + offsetof(Vertex, texCoord)));
     glEnableVertexAttribArray(1);
     // Vertex Colour
     glVertexAttribPointer(2, 4, GL_FLOAT, GL_FALSE, sizeof(Vertex),
-                          (const void*)offsetof(Vertex, colour));
+                          (const void*)(base + offsetof(Vertex, colour)));
     glEnableVertexAttribArray(2);
 
     glUniformMatrix4fv(m_boundPipeline->ModelTransformIndex(), 1, GL_FALSE, transform.matrix());
     glUniformMatrix4fv(m_boundPipeline->CanvasTransformIndex(), 1, GL_FALSE, view.matrix());
+}
 
-    glDrawArrays(GL_TRIANGLE_STRIP, firstVertex, vertexCount);
+void GLRenderer::reserve_quad_indices(unsigned quadCount) {
+    if (quadCount <= m_quadIndexCapacity) {
+        return;
+    }
+
+    // Grow geometrically so growing scenes do not regenerate the buffer every frame
+    unsigned capacity = std::max(quadCount, m_quadIndexCapacity * 2);
+
+    std::vector<GLuint> indices(capacity * 6);
+    for (unsigned i = 0; i < capacity; i++) {
+        GLuint v = i * 4;
+        GLuint* quad = &indices[i * 6];
+
+        quad[0] = v;
+        quad[1] = v + 1;
+        quad[2] = v + 2;
+        quad[3] = v + 2;
+        quad[4] = v + 1;
+        quad[5] = v + 3;
+    }
+
+    if (!m_quadIndexBuffer) {
+        glCheck(glGenBuffers(1, &m_quadIndexBuffer));
+    }
+
+    // Unbind the VAO so the previous element array binding is left alone
+    glBindVertexArray(0);
+    glCheck(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_quadIndexBuffer));
+    glCheck(glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(GLuint),
+                         indices.data(), GL_STATIC_DRAW));
+    glCheck(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0));
+
+    m_quadIndexCapacity = capacity;
 }
 
 Texture::TextureHandle GLRenderer::allocate_texture(const Vector2u& size, Texture::Format format) {
@@ -313,19 +519,21 @@ Texture::TextureHandle GLRenderer::allocate_texture(const Vector2u& size, Textur
     glCheck(glTexStorage2D(GL_TEXTURE_2D, 1, glFormat, size.x, size.y));
 
     GLTexture* tex = new GLTexture{texID, size, glFormat, format};
-    m_textures.insert(tex);
 
     // Unbind texture
     glCheck(glBindTexture(GL_TEXTURE_2D, 0));
-    return tex;
+    return m_textures.insert(tex);
 }
 
 void GLRenderer::update_texture(Texture::TextureHandle texHandle, const void* data) {
     std::unique_lock lockGL(m_glMutex);
     acquire_stream_context_if_necessary();
 
-    GLTexture* tex = reinterpret_cast<GLTexture*>(texHandle);
-    assert(m_textures.contains(tex));
+    GLTexture* tex = m_textures.get(texHandle);
+    if (!tex) {
+        Logger::Warning("GLRenderer: Invalid texture handle {}.", texHandle);
+        return;
+    }
 
     glCheck(glBindTexture(GL_TEXTURE_2D, tex->id));
     GLuint nonSizedFormat;
@@ -354,11 +562,11 @@ void GLRenderer::destroy_texture(Texture::TextureHandle texHandle) {
     std::unique_lock lockGL(m_glMutex);
     acquire_stream_context_if_necessary();
 
-    GLTexture* tex = reinterpret_cast<GLTexture*>(texHandle);
-
-    size_t erased = m_textures.erase(tex);
-    assert(erased ==
-           1); // Erase returns the amount of textures erased, ensure that this is exactly 1
+    GLTexture* tex = m_textures.erase(texHandle);
+    if (!tex) {
+        Logger::Warning("GLRenderer: Invalid texture handle {}.", texHandle);
+        return;
+    }
 
     // Delete OpenGL texture
     glDeleteTextures(1, &tex->id);
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <Arclight/Graphics/Rendering/HandleTable.h>
 #include <Arclight/Graphics/Rendering/Renderer.h>
 #include <Arclight/Graphics/Transform.h>
 #include <Arclight/Platform/Platform.h>
@@ -14,7 +15,12 @@
 #include <SDL2/SDL_video.h>
 
 #include <cassert>
+#include <memory>
 #include <mutex>
+#include <vector>
+
+// Initial size of the transient memory block in bytes, grows to fit the largest frame
+#define GLRENDERER_TRANSIENT_BLOCK_SIZE (256 * 1024)
 
 namespace Arclight::Rendering {
 
@@ -38,7 +44,17 @@ public:
                     const RenderPipeline::PipelineFixedConfig&) override;
 
     void destroy_pipeline(RenderPipeline::PipelineHandle) override;
+    bool pipeline_valid(RenderPipeline::PipelineHandle handle) const override {
+        return m_pipelines.contains(handle);
+    }
     RenderPipeline& default_pipeline() override;
+    // Primitive type is chosen per draw call in OpenGL, the default pipeline is used
+    RenderPipeline& default_batch_pipeline() override { return default_pipeline(); }
+    RenderPipeline& default_instanced_pipeline() override { return *m_defaultInstancedPipeline; }
+    RenderPipeline& default_sdf_pipeline() override { return *m_defaultSDFPipeline; }
+    RenderPipeline& default_sdf_instanced_pipeline() override {
+        return *m_defaultSDFInstancedPipeline;
+    }
 
     void bind_pipeline(RenderPipeline::PipelineHandle pipeline) override;
     void bind_texture(Texture::TextureHandle texture) override;
@@ -49,7 +65,12 @@ public:
     void* get_vertex_buffer_mapping(void* buffer) override;
     void destroy_vertex_buffer(void* buffer) override;
 
+    TransientAllocation allocate_transient(size_t size) override;
+
     void do_draw_call(unsigned firstVertex, unsigned vertexCount, const Matrix4& transform, const Matrix4& view) override;
+    void do_draw_indexed_call(unsigned firstVertex, unsigned indexCount, const Matrix4& transform, const Matrix4& view) override;
+    void upload_instances(const SpriteInstance* instances, unsigned instanceCount) override;
+    void do_draw_instanced_call(unsigned firstInstance, unsigned instanceCount, const Matrix4& view) override;
     Texture::TextureHandle allocate_texture(const Vector2u& size, Texture::Format format) override;
     void update_texture(Texture::TextureHandle, const void*) override;
     void destroy_texture(Texture::TextureHandle) override;
@@ -89,6 +110,13 @@ private:
         unsigned vertexCount;
     };
 
+    // Transient memory is written on the CPU and uploaded by render(),
+    // orphaning the buffer so the driver never waits for a frame in flight to finish with it
+    struct GLTransientBlock {
+        GLVertexBuffer buffer; // Created on the GL thread by upload_transient()
+        std::unique_ptr<uint8_t[]> data;
+    };
+
     // Returns true if the thread is the owner of the GL context
     bool is_gl_thread();
     void die_if_not_gl_thread();
@@ -98,6 +126,19 @@ private:
     // called on init and resize
     void UpdateViewportTransform();
 
+    // Bind the VAO and vertex buffer and set up the vertex attributes and transform uniforms,
+    // OpenGL ES has no base vertex so attributes start at firstVertex
+    void prepare_draw(unsigned firstVertex, const Matrix4& transform, const Matrix4& view);
+
+    // Make sure the quad index buffer can hold quadCount quads
+    void reserve_quad_indices(unsigned quadCount);
+
+    TransientBlock create_transient_block(size_t size) override;
+    // Deletes the GL buffer, must be called on the GL thread
+    void destroy_transient_block(const TransientBlock& block) override;
+    // Upload the transient memory of the frame before any draw call
+    void upload_transient();
+
     // Helps prevent rebinding the program across draw calls
     GLuint m_lastProgram;
     class GLPipeline* m_boundPipeline;
@@ -111,6 +152,22 @@ private:
     GLVBO GetVertexBufferObject(unsigned vertexCount);
     GLuint m_vbo;
 
+    // Shared index buffer for draw_quads, indices are 0, 1, 2, 2, 1, 3 for each quad
+    GLuint m_quadIndexBuffer = 0;
+    unsigned m_quadIndexCapacity = 0; // In quads
+
+    // Instanced sprites, the unit quad is drawn as a triangle strip
+    GLuint m_unitQuadBuffer = 0;
+    GLuint m_instanceBuffer = 0;
+    unsigned m_instanceCapacity = 0; // In instances
+
+    // Transient memory, reset by render() once the frame no longer reads it
+    std::mutex m_transientLock;
+    TransientChain m_transientChain{GLRENDERER_TRANSIENT_BLOCK_SIZE};
+    // Buffers of the transient blocks, tagged apart from m_vbos
+    // as both are bound through bind_vertex_buffer()
+    HandleTable<GLVertexBuffer> m_transientBuffers{1};
+
     WindowContext* m_windowContext;
     Transform2D m_viewportTransform;
 
@@ -126,10 +183,13 @@ private:
 #endif
 
     std::unique_ptr<RenderPipeline> m_defaultPipeline;
-    std::set<class GLPipeline*> m_pipelines;
-    std::set<GLVertexBuffer*> m_vbos;
+    std::unique_ptr<RenderPipeline> m_defaultInstancedPipeline;
+    std::unique_ptr<RenderPipeline> m_defaultSDFPipeline;
+    std::unique_ptr<RenderPipeline> m_defaultSDFInstancedPipeline;
+    HandleTable<class GLPipeline> m_pipelines;
+    HandleTable<GLVertexBuffer> m_vbos;
 
-    std::set<GLTexture*> m_textures;
+    HandleTable<GLTexture> m_textures;
 
     unsigned long long m_debugFrameCounter = 0;
 };
@@ -0,0 +1,910 @@
+#include <Rendering/Software/SoftwareRenderer.h>
+
+#include <Arclight/Core/Fatal.h>
+#include <Arclight/Core/File.h>
+#include <Arclight/Core/Logger.h>
+#include <Arclight/Core/ParallelFor.h>
+#include <Arclight/Core/Util.h>
+#include <Arclight/Window/WindowContext.h>
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+
+#include <SDL.h>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#define SOFTWARERENDERER_SSE2 1
+#include <emmintrin.h>
+#endif
+
+namespace Arclight::Rendering {
+
+namespace {
+
+ALWAYS_INLINE float clamp01(float value) { return std::min(std::max(value, 0.f), 1.f); }
+
+ALWAYS_INLINE float smoothstep(float edge0, float edge1, float x) {
+    const float t = clamp01((x - edge0) / (edge1 - edge0));
+    return t * t * (3.f - 2.f * t);
+}
+
+ALWAYS_INLINE float channel(uint32_t pixel, unsigned shift) {
+    return static_cast<float>((pixel >> shift) & 0xff);
+}
+
+#ifdef SOFTWARERENDERER_SSE2
+template <int Shift> ALWAYS_INLINE __m128 channel4(__m128i pixels) {
+    return _mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(pixels, Shift), _mm_set1_epi32(0xff)));
+}
+
+ALWAYS_INLINE __m128 clamp01_4(__m128 value) {
+    return _mm_min_ps(_mm_max_ps(value, _mm_setzero_ps()), _mm_set1_ps(1.f));
+}
+
+ALWAYS_INLINE __m128 truncate4(__m128 value) {
+    return _mm_cvtepi32_ps(_mm_cvttps_epi32(value));
+}
+
+// SSE2 has no floor, truncate and correct negative values
+ALWAYS_INLINE __m128 floor4(__m128 value) {
+    const __m128 truncated = truncate4(value);
+    return _mm_sub_ps(truncated,
+                      _mm_and_ps(_mm_cmpgt_ps(truncated, value), _mm_set1_ps(1.f)));
+}
+#endif
+
+// PNG, stored (uncompressed) deflate blocks keep the encoder small and fast
+constexpr std::array<uint32_t, 256> crcTable = [] {
+    std::array<uint32_t, 256> table = {};
+    for (uint32_t n = 0; n < 256; n++) {
+        uint32_t c = n;
+        for (int k = 0; k < 8; k++) {
+            c = (c & 1) ? 0xedb88320u ^ (c >> 1) : c >> 1;
+        }
+
+        table[n] = c;
+    }
+
+    return table;
+}();
+
+void append_u32(std::vector<uint8_t>& out, uint32_t value) {
+    out.push_back(value >> 24);
+    out.push_back(value >> 16);
+    out.push_back(value >> 8);
+    out.push_back(value);
+}
+
+void append_chunk(std::vector<uint8_t>& png, const char* type, const std::vector<uint8_t>& data) {
+    append_u32(png, static_cast<uint32_t>(data.size()));
+
+    const size_t typeOffset = png.size();
+    png.insert(png.end(), type, type + 4);
+    png.insert(png.end(), data.begin(), data.end());
+
+    // Over the type and the data
+    uint32_t crc = 0xffffffffu;
+    for (size_t i = typeOffset; i < png.size(); i++) {
+        crc = crcTable[(crc ^ png[i]) & 0xff] ^ (crc >> 8);
+    }
+
+    append_u32(png, crc ^ 0xffffffffu);
+}
+
+std::vector<uint8_t> encode_png(const uint32_t* pixels, const Vector2i& size) {
+    // Every row starts with its filter type, 0 is none
+    const size_t rowSize = static_cast<size_t>(size.x) * 4 + 1;
+    std::vector<uint8_t> raw(rowSize * size.y);
+    for (int y = 0; y < size.y; y++) {
+        uint8_t* row = &raw[y * rowSize];
+        *row++ = 0;
+
+        for (int x = 0; x < size.x; x++) {
+            const uint32_t pixel = pixels[static_cast<size_t>(y) * size.x + x];
+            *row++ = pixel;
+            *row++ = pixel >> 8;
+            *row++ = pixel >> 16;
+            *row++ = pixel >> 24;
+        }
+    }
+
+    std::vector<uint8_t> zlib = {0x78, 0x01};
+    zlib.reserve(raw.size() + raw.size() / 65535 * 5 + 16);
+
+    size_t offset = 0;
+    do {
+        const size_t blockSize = std::min<size_t>(raw.size() - offset, 65535);
+        const bool last = offset + blockSize == raw.size();
+
+        zlib.push_back(last ? 1 : 0);
+        zlib.push_back(blockSize);
+        zlib.push_back(blockSize >> 8);
+        zlib.push_back(~blockSize);
+        zlib.push_back(~blockSize >> 8);
+        zlib.insert(zlib.end(), raw.begin() + offset, raw.begin() + offset + blockSize);
+
+        offset += blockSize;
+    } while (offset < raw.size());
+
+    uint32_t adlerA = 1, adlerB = 0;
+    for (uint8_t byte : raw) {
+        adlerA = (adlerA + byte) % 65521;
+        adlerB = (adlerB + adlerA) % 65521;
+    }
+    append_u32(zlib, (adlerB << 16) | adlerA);
+
+    std::vector<uint8_t> header;
+    append_u32(header, size.x);
+    append_u32(header, size.y);
+    // 8 bits per channel, RGBA, deflate, no filtering, no interlacing
+    header.insert(header.end(), {8, 6, 0, 0, 0});
+
+    std::vector<uint8_t> png = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n'};
+    append_chunk(png, "IHDR", header);
+    append_chunk(png, "IDAT", zlib);
+    append_chunk(png, "IEND", {});
+    return png;
+}
+
+} // namespace
+
+SoftwareRenderer::~SoftwareRenderer() {
+    m_defaultPipeline.reset();
+    m_defaultInstancedPipeline.reset();
+    m_defaultSDFPipeline.reset();
+    m_defaultSDFInstancedPipeline.reset();
+
+    m_pipelines.for_each([](SoftwarePipeline* p) { delete p; });
+    m_textures.for_each([](SoftwareTexture* t) { delete t; });
+    m_vertexBuffers.for_each([](SoftwareVertexBuffer* b) { delete b; });
+    m_transientChain.destroy(*this);
+}
+
+int SoftwareRenderer::initialize(class WindowContext* context) {
+    m_windowContext = context;
+    s_rendererInstance = this;
+
+    if (context) {
+        resize_viewport(context->get_size());
+    }
+
+    if (const char* dumpPath = getenv("ARCLIGHT_SOFTWARE_FRAME_DUMP")) {
+        m_frameDumpPath = dumpPath;
+        Logger::Debug("SoftwareRenderer: Saving frames to '{}'", m_frameDumpPath);
+    }
+
+    {
+        // The shaders only identify the pipelines, shading is picked below
+        Shader vertShader(Shader::VertexShader);
+        Shader fragShader(Shader::FragmentShader);
+
+        RenderPipeline::PipelineFixedConfig instancedConfig = RenderPipeline::defaultConfig;
+        instancedConfig.vertexLayout = RenderPipeline::VertexLayoutSpriteInstance;
+
+        m_defaultPipeline = std::make_unique<RenderPipeline>(vertShader, fragShader);
+        m_defaultInstancedPipeline =
+            std::make_unique<RenderPipeline>(vertShader, fragShader, instancedConfig);
+        m_defaultSDFPipeline = std::make_unique<RenderPipeline>(vertShader, fragShader);
+        m_defaultSDFInstancedPipeline =
+            std::make_unique<RenderPipeline>(vertShader, fragShader, instancedConfig);
+
+        m_pipelines.get(m_defaultSDFPipeline->handle())->shading = ShadingSDF;
+        m_pipelines.get(m_defaultSDFInstancedPipeline->handle())->shading = ShadingSDF;
+    }
+
+    return 0;
+}
+
+void SoftwareRenderer::render() {
+    if (m_windowContext) {
+        m_clearColour = m_windowContext->backgroundColour.value;
+    }
+
+    m_vertices.clear();
+    m_triangles.clear();
+    m_drawStates.clear();
+
+    // Issues the draw calls, which only collect triangles
+    Renderer::render();
+    {
+        std::scoped_lock lock(m_transientLock);
+        m_transientChain.reset(*this);
+    }
+
+    m_setups.resize(m_triangles.size());
+    parallel_for(m_triangles.size(), SOFTWARERENDERER_SETUP_GRAIN_SIZE,
+                 [this](size_t begin, size_t end) {
+                     for (size_t i = begin; i < end; i++) {
+                         TriangleSetup& setup = m_setups[i];
+                         if (!setup_triangle(m_triangles[i], setup)) {
+                             setup.minX = setup.maxX = 0;
+                         }
+                     }
+                 });
+
+    // Binning keeps draw order within every tile
+    for (auto& bin : m_bins) {
+        bin.clear();
+    }
+
+    for (uint32_t i = 0; i < m_setups.size(); i++) {
+        const TriangleSetup& setup = m_setups[i];
+        if (setup.minX >= setup.maxX || setup.minY >= setup.maxY) {
+            continue;
+        }
+
+        for (int ty = setup.minY / SOFTWARERENDERER_TILE_SIZE;
+             ty <= (setup.maxY - 1) / SOFTWARERENDERER_TILE_SIZE; ty++) {
+            for (int tx = setup.minX / SOFTWARERENDERER_TILE_SIZE;
+                 tx <= (setup.maxX - 1) / SOFTWARERENDERER_TILE_SIZE; tx++) {
+                m_bins[ty * m_tileCount.x + tx].push_back(i);
+            }
+        }
+    }
+
+    // Tiles own their pixels, no synchronisation needed
+    parallel_for(m_bins.size(), 1, [this](size_t begin, size_t end) {
+        for (size_t tile = begin; tile < end; tile++) {
+            rasterise_tile(static_cast<unsigned>(tile));
+        }
+    });
+
+    present();
+
+    if (!m_frameDumpPath.empty()) {
+        save_png(fmt::format("{}/frame_{:06}.png", m_frameDumpPath, m_frameCounter));
+    }
+
+    m_frameCounter++;
+}
+
+void SoftwareRenderer::resize_viewport(const Vector2i& newPixelSize) {
+    m_size = {std::max(newPixelSize.x, 0), std::max(newPixelSize.y, 0)};
+    m_framebuffer.assign(static_cast<size_t>(m_size.x) * m_size.y, m_clearColour);
+
+    m_tileCount = {(m_size.x + SOFTWARERENDERER_TILE_SIZE - 1) / SOFTWARERENDERER_TILE_SIZE,
+                   (m_size.y + SOFTWARERENDERER_TILE_SIZE - 1) / SOFTWARERENDERER_TILE_SIZE};
+    m_bins.resize(m_tileCount.x * m_tileCount.y);
+}
+
+RenderPipeline::PipelineHandle
+SoftwareRenderer::create_pipeline(const Shader&, const Shader&,
+                                  const RenderPipeline::PipelineFixedConfig& config) {
+    SoftwarePipeline* pipeline =
+        new SoftwarePipeline{ShadingDefault, config.topology, config.vertexLayout};
+
+    std::scoped_lock lock(m_resourceLock);
+    return m_pipelines.insert(pipeline);
+}
+
+void SoftwareRenderer::destroy_pipeline(RenderPipeline::PipelineHandle handle) {
+    std::scoped_lock lock(m_resourceLock);
+    SoftwarePipeline* pipeline = m_pipelines.erase(handle);
+    if (!pipeline) {
+        Logger::Warning("SoftwareRenderer: Invalid pipeline handle {}.", handle);
+        return;
+    }
+
+    if (m_boundPipeline == pipeline) {
+        m_boundPipeline = nullptr;
+    }
+
+    delete pipeline;
+}
+
+void SoftwareRenderer::bind_pipeline(RenderPipeline::PipelineHandle pipeline) {
+    m_boundPipeline = m_pipelines.get(pipeline);
+    if (pipeline && !m_boundPipeline) {
+        Logger::Warning("SoftwareRenderer: Invalid pipeline handle {}.", pipeline);
+    }
+}
+
+void SoftwareRenderer::bind_texture(Texture::TextureHandle texture) {
+    m_boundTexture = m_textures.get(texture);
+    if (texture && !m_boundTexture) {
+        Logger::Warning("SoftwareRenderer: Invalid texture handle {}.", texture);
+    }
+}
+
+void SoftwareRenderer::bind_vertex_buffer(void* buffer) {
+    m_boundVertexBuffer = m_vertexBuffers.get(buffer);
+    if (!m_boundVertexBuffer) {
+        m_boundVertexBuffer = m_transientBuffers.get(buffer);
+    }
+
+    if (buffer && !m_boundVertexBuffer) {
+        Logger::Warning("SoftwareRenderer: Invalid vertex buffer handle {}.", buffer);
+    }
+}
+
+void* SoftwareRenderer::allocate_vertex_buffer(unsigned vertexCount) {
+    SoftwareVertexBuffer* buffer = new SoftwareVertexBuffer;
+    buffer->vertices.resize(vertexCount);
+
+    std::scoped_lock lock(m_resourceLock);
+    return m_vertexBuffers.insert(buffer);
+}
+
+void SoftwareRenderer::update_vertex_buffer(void* buffer, unsigned int offset, unsigned int size,
+                                            const Vertex* vertices) {
+    SoftwareVertexBuffer* vbo = m_vertexBuffers.get(buffer);
+    if (!vbo) {
+        Logger::Warning("SoftwareRenderer: Invalid vertex buffer handle {}.", buffer);
+        return;
+    }
+
+    assert(offset + size <= vbo->vertices.size());
+    std::copy(vertices, vertices + size, vbo->vertices.begin() + offset);
+}
+
+void* SoftwareRenderer::get_vertex_buffer_mapping(void* buffer) {
+    SoftwareVertexBuffer* vbo = m_vertexBuffers.get(buffer);
+    if (!vbo) {
+        Logger::Warning("SoftwareRenderer: Invalid vertex buffer handle {}.", buffer);
+        return nullptr;
+    }
+
+    return vbo->vertices.data();
+}
+
+void SoftwareRenderer::destroy_vertex_buffer(void* buffer) {
+    std::scoped_lock lock(m_resourceLock);
+    SoftwareVertexBuffer* vbo = m_vertexBuffers.erase(buffer);
+    if (!vbo) {
+        Logger::Warning("SoftwareRenderer: Invalid vertex buffer handle {}.", buffer);
+        return;
+    }
+
+    if (m_boundVertexBuffer == vbo) {
+        m_boundVertexBuffer = nullptr;
+    }
+
+    delete vbo;
+}
+
+Renderer::TransientAllocation SoftwareRenderer::allocate_transient(size_t size) {
+    std::scoped_lock lock(m_transientLock);
+    return m_transientChain.allocate(*this, size);
+}
+
+Renderer::TransientBlock SoftwareRenderer::create_transient_block(size_t size) {
+    SoftwareVertexBuffer* buffer = new SoftwareVertexBuffer;
+    buffer->vertices.resize((size + sizeof(Vertex) - 1) / sizeof(Vertex));
+    buffer->handle = m_transientBuffers.insert(buffer);
+
+    return {reinterpret_cast<uint8_t*>(buffer->vertices.data()),
+            buffer->vertices.size() * sizeof(Vertex), 0, buffer->handle, buffer};
+}
+
+void SoftwareRenderer::destroy_transient_block(const TransientBlock& block) {
+    SoftwareVertexBuffer* buffer = static_cast<SoftwareVertexBuffer*>(block.backend);
+    if (m_boundVertexBuffer == buffer) {
+        m_boundVertexBuffer = nullptr;
+    }
+
+    m_transientBuffers.erase(buffer->handle);
+    delete buffer;
+}
+
+Texture::TextureHandle SoftwareRenderer::allocate_texture(const Vector2u& size,
+                                                          Texture::Format format) {
+    SoftwareTexture* texture = new SoftwareTexture{size, format, {}};
+    texture->texels.resize(static_cast<size_t>(size.x) * size.y, 0xffffffff);
+
+    std::scoped_lock lock(m_resourceLock);
+    return m_textures.insert(texture);
+}
+
+void SoftwareRenderer::update_texture(Texture::TextureHandle handle, const void* data) {
+    SoftwareTexture* texture = m_textures.get(handle);
+    if (!texture) {
+        Logger::Warning("SoftwareRenderer: Invalid texture handle {}.", handle);
+        return;
+    }
+
+    const uint8_t* pixels = reinterpret_cast<const uint8_t*>(data);
+    std::vector<uint32_t>& texels = texture->texels;
+
+    switch (texture->format) {
+    case Texture::Format_RGBA8_SRGB:
+        for (size_t i = 0; i < texels.size(); i++, pixels += 4) {
+            texels[i] = pixels[0] | (pixels[1] << 8) | (pixels[2] << 16) |
+                        (static_cast<uint32_t>(pixels[3]) << 24);
+        }
+        break;
+    case Texture::Format_RGB8_SRGB:
+        for (size_t i = 0; i < texels.size(); i++, pixels += 3) {
+            texels[i] = pixels[0] | (pixels[1] << 8) | (pixels[2] << 16) | 0xff000000u;
+        }
+        break;
+    case Texture::Format_A8_SRGB:
+        for (size_t i = 0; i < texels.size(); i++) {
+            texels[i] = 0x00ffffffu | (static_cast<uint32_t>(pixels[i]) << 24);
+        }
+        break;
+    default:
+        FatalRuntimeError("Invalid texture format");
+    }
+}
+
+void SoftwareRenderer::destroy_texture(Texture::TextureHandle handle) {
+    std::scoped_lock lock(m_resourceLock);
+    SoftwareTexture* texture = m_textures.erase(handle);
+    if (!texture) {
+        Logger::Warning("SoftwareRenderer: Invalid texture handle {}.", handle);
+        return;
+    }
+
+    if (m_boundTexture == texture) {
+        m_boundTexture = nullptr;
+    }
+
+    delete texture;
+}
+
+bool SoftwareRenderer::save_png(const std::string& path) const {
+    if (m_framebuffer.empty()) {
+        Logger::Warning("SoftwareRenderer::save_png: Framebuffer is empty");
+        return false;
+    }
+
+    const std::vector<uint8_t> png = encode_png(m_framebuffer.data(), m_size);
+
+    File* file = File::Open(path.c_str(), File::OpenWrite);
+    if (!file) {
+        Logger::Error("SoftwareRenderer::save_png: Failed to open '{}'", path);
+        return false;
+    }
+
+    bool failed = file->Write(png.data(), png.size()) < static_cast<ssize_t>(png.size());
+    delete file;
+
+    if (failed) {
+        Logger::Error("SoftwareRenderer::save_png: Failed to write '{}'", path);
+    }
+
+    return !failed;
+}
+
+uint32_t SoftwareRenderer::add_vertices(const Vertex* vertices, unsigned vertexCount,
+                                        const Matrix4& transform, const Matrix4& view) {
+    // Window coordinates are framebuffer pixels
+    Matrix4 combined = view;
+    combined *= transform;
+    const float* m = combined.matrix();
+
+    const uint32_t first = static_cast<uint32_t>(m_vertices.size());
+    m_vertices.resize(first + vertexCount);
+
+    ScreenVertex* out = &m_vertices[first];
+    for (unsigned i = 0; i < vertexCount; i++) {
+        const Vertex& v = vertices[i];
+        out[i] = {
+            m[0] * v.position.x + m[4] * v.position.y + m[12],
+            m[1] * v.position.x + m[5] * v.position.y + m[13],
+            v.texCoord.x,
+            v.texCoord.y,
+            v.colour.x,
+            v.colour.y,
+            v.colour.z,
+            v.colour.w,
+        };
+    }
+
+    return first;
+}
+
+uint32_t SoftwareRenderer::add_draw_state() {
+    assert(m_boundPipeline);
+
+    const DrawState state = {m_boundTexture, m_boundPipeline->shading};
+    if (m_drawStates.empty() || m_drawStates.back().texture != state.texture ||
+        m_drawStates.back().shading != state.shading) {
+        m_drawStates.push_back(state);
+    }
+
+    return static_cast<uint32_t>(m_drawStates.size() - 1);
+}
+
+void SoftwareRenderer::do_draw_call(unsigned firstVertex, unsigned vertexCount,
+                                    const Matrix4& transform, const Matrix4& view) {
+    assert(m_boundVertexBuffer &&
+           firstVertex + vertexCount <= m_boundVertexBuffer->vertices.size());
+    if (vertexCount < 3) {
+        return;
+    }
+
+    const uint32_t base = add_vertices(m_boundVertexBuffer->vertices.data() + firstVertex,
+                                       vertexCount, transform, view);
+    const uint32_t state = add_draw_state();
+
+    if (m_boundPipeline->topology == RenderPipeline::PrimitiveTriangleList) {
+        for (uint32_t i = 0; i + 3 <= vertexCount; i += 3) {
+            m_triangles.push_back({{base + i, base + i + 1, base + i + 2}, state});
+        }
+    } else {
+        for (uint32_t i = 0; i + 2 < vertexCount; i++) {
+            m_triangles.push_back({{base + i, base + i + 1, base + i + 2}, state});
+        }
+    }
+}
+
+void SoftwareRenderer::do_draw_indexed_call(unsigned firstVertex, unsigned indexCount,
+                                            const Matrix4& transform, const Matrix4& view) {
+    const unsigned quadCount = indexCount / 6;
+    assert(m_boundVertexBuffer &&
+           firstVertex + quadCount * 4 <= m_boundVertexBuffer->vertices.size());
+
+    const uint32_t base = add_vertices(m_boundVertexBuffer->vertices.data() + firstVertex,
+                                       quadCount * 4, transform, view);
+    const uint32_t state = add_draw_state();
+
+    // Same indices as the quad index buffers of the GPU backends
+    for (uint32_t q = 0; q < quadCount; q++) {
+        const uint32_t v = base + q * 4;
+        m_triangles.push_back({{v, v + 1, v + 2}, state});
+        m_triangles.push_back({{v + 2, v + 1, v + 3}, state});
+    }
+}
+
+void SoftwareRenderer::upload_instances(const SpriteInstance* instances, unsigned instanceCount) {
+    m_instances.assign(instances, instances + instanceCount);
+}
+
+void SoftwareRenderer::do_draw_instanced_call(unsigned firstInstance, unsigned instanceCount,
+                                              const Matrix4& view) {
+    assert(firstInstance + instanceCount <= m_instances.size());
+
+    // Bottom left, top left, bottom right, top right like Sprite::vertices
+    const float unitQuad[4][2] = {{0.f, 1.f}, {0.f, 0.f}, {1.f, 1.f}, {1.f, 0.f}};
+    const float* m = view.matrix();
+    const uint32_t state = add_draw_state();
+
+    uint32_t v = static_cast<uint32_t>(m_vertices.size());
+    m_vertices.resize(v + instanceCount * 4);
+    m_triangles.reserve(m_triangles.size() + instanceCount * 2);
+
+    for (unsigned i = 0; i < instanceCount; i++, v += 4) {
+        const SpriteInstance& instance = m_instances[firstInstance + i];
+        const float* t = instance.transform;
+        const float* uv = instance.uvRect;
+        const uint32_t colour = instance.colour;
+
+        for (int corner = 0; corner < 4; corner++) {
+            const float px = unitQuad[corner][0];
+            const float py = unitQuad[corner][1];
+            const float wx = t[0] * px + t[2] * py + instance.translation[0];
+            const float wy = t[1] * px + t[3] * py + instance.translation[1];
+
+            m_vertices[v + corner] = {
+                m[0] * wx + m[4] * wy + m[12],
+                m[1] * wx + m[5] * wy + m[13],
+                uv[0] + (uv[2] - uv[0]) * px,
+                uv[1] + (uv[3] - uv[1]) * py,
+                channel(colour, 0) / 255.f,
+                channel(colour, 8) / 255.f,
+                channel(colour, 16) / 255.f,
+                channel(colour, 24) / 255.f,
+            };
+        }
+
+        m_triangles.push_back({{v, v + 1, v + 2}, state});
+        m_triangles.push_back({{v + 1, v + 2, v + 3}, state});
+    }
+}
+
+bool SoftwareRenderer::setup_triangle(const Triangle& triangle, TriangleSetup& setup) const {
+    const ScreenVertex& v0 = m_vertices[triangle.vertices[0]];
+    const ScreenVertex& v1 = m_vertices[triangle.vertices[1]];
+    const ScreenVertex& v2 = m_vertices[triangle.vertices[2]];
+
+    const float area = (v1.x - v0.x) * (v2.y - v0.y) - (v2.x - v0.x) * (v1.y - v0.y);
+    if (area == 0.f || !std::isfinite(area)) {
+        return false;
+    }
+
+    const float minX = std::floor(std::min({v0.x, v1.x, v2.x}));
+    const float minY = std::floor(std::min({v0.y, v1.y, v2.y}));
+    const float maxX = std::ceil(std::max({v0.x, v1.x, v2.x}));
+    const float maxY = std::ceil(std::max({v0.y, v1.y, v2.y}));
+
+    setup.minX = static_cast<int>(std::clamp(minX, 0.f, static_cast<float>(m_size.x)));
+    setup.minY = static_cast<int>(std::clamp(minY, 0.f, static_cast<float>(m_size.y)));
+    setup.maxX = static_cast<int>(std::clamp(maxX, 0.f, static_cast<float>(m_size.x)));
+    setup.maxY = static_cast<int>(std::clamp(maxY, 0.f, static_cast<float>(m_size.y)));
+    if (setup.minX >= setup.maxX || setup.minY >= setup.maxY) {
+        return false;
+    }
+
+    // Edge i is opposite vertex i. Triangles sharing an edge get exactly negated
+    // coefficients, so the fill rule in rasterise_tile covers shared edges once.
+    const ScreenVertex* v[3] = {&v0, &v1, &v2};
+    const float sign = area > 0.f ? 1.f : -1.f;
+    for (int i = 0; i < 3; i++) {
+        const ScreenVertex& a = *v[(i + 1) % 3];
+        const ScreenVertex& b = *v[(i + 2) % 3];
+
+        setup.edges[i][0] = sign * (a.y - b.y);
+        setup.edges[i][1] = sign * (b.x - a.x);
+        setup.edges[i][2] = sign * (a.x * b.y - b.x * a.y);
+    }
+
+    const float attributes[3][6] = {
+        {v0.u, v0.v, v0.r, v0.g, v0.b, v0.a},
+        {v1.u, v1.v, v1.r, v1.g, v1.b, v1.a},
+        {v2.u, v2.v, v2.r, v2.g, v2.b, v2.a},
+    };
+
+    const float inverseArea = 1.f / area;
+    for (int i = 0; i < 6; i++) {
+        const float d1 = attributes[1][i] - attributes[0][i];
+        const float d2 = attributes[2][i] - attributes[0][i];
+
+        float* plane = setup.planes[i];
+        plane[0] = (d1 * (v2.y - v0.y) - d2 * (v1.y - v0.y)) * inverseArea;
+        plane[1] = (d2 * (v1.x - v0.x) - d1 * (v2.x - v0.x)) * inverseArea;
+        plane[2] = attributes[0][i] - plane[0] * v0.x - plane[1] * v0.y;
+    }
+
+    setup.state = triangle.state;
+    setup.sdfWidth = 0.f;
+    setup.repeat = false;
+    for (const ScreenVertex* vertex : v) {
+        if (vertex->u < 0.f || vertex->u > 1.f || vertex->v < 0.f || vertex->v > 1.f) {
+            setup.repeat = true;
+        }
+    }
+
+    const DrawState& state = m_drawStates[triangle.state];
+    if (state.shading == ShadingSDF && state.texture) {
+        // Equivalent of fwidth in the SDF shaders, the distance changes by
+        // 1 / (2 * spread) every texel and the texture scale is constant over the triangle
+        const Vector2u& size = state.texture->size;
+        const float texelsPerPixel =
+            0.5f * ((std::abs(setup.planes[0][0]) + std::abs(setup.planes[0][1])) * size.x +
+                    (std::abs(setup.planes[1][0]) + std::abs(setup.planes[1][1])) * size.y);
+
+        setup.sdfWidth = std::max(texelsPerPixel / (2.f * SOFTWARERENDERER_SDF_SPREAD), 1e-4f);
+    }
+
+    return true;
+}
+
+void SoftwareRenderer::rasterise_tile(unsigned tile) {
+    const int tileX = (tile % m_tileCount.x) * SOFTWARERENDERER_TILE_SIZE;
+    const int tileY = (tile / m_tileCount.x) * SOFTWARERENDERER_TILE_SIZE;
+    const int tileEndX = std::min(tileX + SOFTWARERENDERER_TILE_SIZE, m_size.x);
+    const int tileEndY = std::min(tileY + SOFTWARERENDERER_TILE_SIZE, m_size.y);
+
+    for (int y = tileY; y < tileEndY; y++) {
+        uint32_t* row = &m_framebuffer[static_cast<size_t>(y) * m_size.x];
+        std::fill(row + tileX, row + tileEndX, m_clearColour);
+    }
+
+    for (uint32_t index : m_bins[tile]) {
+        const TriangleSetup& setup = m_setups[index];
+
+        const int beginY = std::max(setup.minY, tileY);
+        const int endY = std::min(setup.maxY, tileEndY);
+        for (int y = beginY; y < endY; y++) {
+            const float py = y + 0.5f;
+
+            // Solve the edge functions for the span of pixel centres inside the triangle.
+            // Left edges include centres on the edge and right edges exclude them,
+            // horizontal edges include them on one side only.
+            float begin = static_cast<float>(std::max(setup.minX, tileX));
+            float end = static_cast<float>(std::min(setup.maxX, tileEndX));
+            for (int e = 0; e < 3; e++) {
+                const float a = setup.edges[e][0];
+                const float f = setup.edges[e][1] * py + setup.edges[e][2];
+
+                if (a > 0.f) {
+                    begin = std::max(begin, std::ceil(-f / a - 0.5f));
+                } else if (a < 0.f) {
+                    end = std::min(end, std::ceil(-f / a - 0.5f));
+                } else if (f < 0.f || (f == 0.f && setup.edges[e][1] <= 0.f)) {
+                    end = begin;
+                }
+            }
+
+            if (begin < end) {
+                shade_span(&m_framebuffer[static_cast<size_t>(y) * m_size.x],
+                           static_cast<int>(begin), static_cast<int>(end), py, setup);
+            }
+        }
+    }
+}
+
+void SoftwareRenderer::shade_span(uint32_t* row, int begin, int end, float y,
+                                  const TriangleSetup& setup) const {
+    const DrawState& state = m_drawStates[setup.state];
+    const SoftwareTexture* texture = state.texture;
+    const bool sdf = state.shading == ShadingSDF;
+
+    // Attribute value at x = 0 on this row
+    float rowBase[6];
+    for (int i = 0; i < 6; i++) {
+        rowBase[i] = setup.planes[i][1] * y + setup.planes[i][2];
+    }
+
+    const uint32_t* texels = texture ? texture->texels.data() : nullptr;
+    const unsigned textureWidth = texture ? texture->size.x : 1;
+    const float width = texture ? static_cast<float>(texture->size.x) : 1.f;
+    const float height = texture ? static_cast<float>(texture->size.y) : 1.f;
+    const float edge0 = 0.5f - setup.sdfWidth;
+    const float edge1 = 0.5f + setup.sdfWidth;
+    const bool repeat = setup.repeat;
+
+    int x = begin;
+
+#ifdef SOFTWARERENDERER_SSE2
+    {
+        // Attributes of the next four pixels, stepped by four pixels every block
+        __m128 attribute[6], step[6];
+        const __m128 laneCentres =
+            _mm_add_ps(_mm_set1_ps(static_cast<float>(x)), _mm_setr_ps(0.5f, 1.5f, 2.5f, 3.5f));
+        for (int i = 0; i < 6; i++) {
+            const __m128 perPixel = _mm_set1_ps(setup.planes[i][0]);
+            attribute[i] = _mm_add_ps(_mm_mul_ps(perPixel, laneCentres), _mm_set1_ps(rowBase[i]));
+            step[i] = _mm_mul_ps(perPixel, _mm_set1_ps(4.f));
+        }
+
+        const __m128 one = _mm_set1_ps(1.f);
+        const __m128 scale = _mm_set1_ps(255.f);
+        const __m128 inverseScale = _mm_set1_ps(1.f / 255.f);
+        const __m128 widthF = _mm_set1_ps(width), maxX = _mm_set1_ps(width - 1.f);
+        const __m128 heightF = _mm_set1_ps(height), maxY = _mm_set1_ps(height - 1.f);
+        const __m128 edge0F = _mm_set1_ps(edge0);
+        const __m128 inverseEdgeWidth = _mm_set1_ps(1.f / (edge1 - edge0));
+
+        for (; x + 4 <= end; x += 4) {
+            __m128 r = attribute[2], g = attribute[3], b = attribute[4], a = attribute[5];
+            const __m128 u0 = attribute[0], v0 = attribute[1];
+            for (int i = 0; i < 6; i++) {
+                attribute[i] = _mm_add_ps(attribute[i], step[i]);
+            }
+
+            if (texels) {
+                __m128 u = u0, v = v0;
+                if (repeat) {
+                    u = _mm_sub_ps(u, floor4(u));
+                    v = _mm_sub_ps(v, floor4(v));
+                }
+
+                // Nearest texel, coordinates are not negative so truncating floors them.
+                // Texel indices stay exact in float up to 2^24 texels.
+                const __m128 tx = truncate4(
+                    _mm_max_ps(_mm_min_ps(_mm_mul_ps(u, widthF), maxX), _mm_setzero_ps()));
+                const __m128 ty = truncate4(
+                    _mm_max_ps(_mm_min_ps(_mm_mul_ps(v, heightF), maxY), _mm_setzero_ps()));
+                const __m128i index = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(ty, widthF), tx));
+
+                // Built in registers, storing lanes separately and loading them
+                // as one vector would stall on store forwarding
+                const __m128i texel = _mm_setr_epi32(
+                    texels[_mm_cvtsi128_si32(index)],
+                    texels[_mm_cvtsi128_si32(_mm_shuffle_epi32(index, _MM_SHUFFLE(1, 1, 1, 1)))],
+                    texels[_mm_cvtsi128_si32(_mm_shuffle_epi32(index, _MM_SHUFFLE(2, 2, 2, 2)))],
+                    texels[_mm_cvtsi128_si32(_mm_shuffle_epi32(index, _MM_SHUFFLE(3, 3, 3, 3)))]);
+                if (sdf) {
+                    const __m128 distance = _mm_mul_ps(channel4<24>(texel), inverseScale);
+                    const __m128 t =
+                        clamp01_4(_mm_mul_ps(_mm_sub_ps(distance, edge0F), inverseEdgeWidth));
+                    const __m128 coverage =
+                        _mm_mul_ps(_mm_mul_ps(t, t),
+                                   _mm_sub_ps(_mm_set1_ps(3.f), _mm_add_ps(t, t)));
+                    a = _mm_mul_ps(a, coverage);
+                } else {
+                    r = _mm_mul_ps(r, _mm_mul_ps(channel4<0>(texel), inverseScale));
+                    g = _mm_mul_ps(g, _mm_mul_ps(channel4<8>(texel), inverseScale));
+                    b = _mm_mul_ps(b, _mm_mul_ps(channel4<16>(texel), inverseScale));
+                    a = _mm_mul_ps(a, _mm_mul_ps(channel4<24>(texel), inverseScale));
+                }
+            }
+
+            a = clamp01_4(a);
+            if (!_mm_movemask_ps(_mm_cmpgt_ps(a, _mm_setzero_ps()))) {
+                continue;
+            }
+
+            // Source over, the destination is kept in 0 to 255
+            const __m128i dst = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row + x));
+            const __m128 srcScale = _mm_mul_ps(a, scale);
+            const __m128 dstScale = _mm_sub_ps(one, a);
+
+            auto blend = [&](__m128 src, __m128 dstChannel) {
+                return _mm_cvtps_epi32(
+                    _mm_add_ps(_mm_mul_ps(clamp01_4(src), srcScale), _mm_mul_ps(dstChannel, dstScale)));
+            };
+
+            const __m128i outR = blend(r, channel4<0>(dst));
+            const __m128i outG = blend(g, channel4<8>(dst));
+            const __m128i outB = blend(b, channel4<16>(dst));
+            const __m128i outA = _mm_cvtps_epi32(
+                _mm_add_ps(srcScale, _mm_mul_ps(channel4<24>(dst), dstScale)));
+
+            const __m128i out =
+                _mm_or_si128(_mm_or_si128(outR, _mm_slli_epi32(outG, 8)),
+                             _mm_or_si128(_mm_slli_epi32(outB, 16), _mm_slli_epi32(outA, 24)));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(row + x), out);
+        }
+    }
+#endif
+
+    // Whole span without SSE2, otherwise the last few pixels
+    for (; x < end; x++) {
+        const float px = x + 0.5f;
+        auto attribute = [&](int i) { return setup.planes[i][0] * px + rowBase[i]; };
+
+        float r = attribute(2), g = attribute(3), b = attribute(4), a = attribute(5);
+
+        if (texels) {
+            float u = attribute(0), v = attribute(1);
+            if (repeat) {
+                u -= std::floor(u);
+                v -= std::floor(v);
+            }
+            const unsigned tx = static_cast<unsigned>(std::clamp(u * width, 0.f, width - 1.f));
+            const unsigned ty = static_cast<unsigned>(std::clamp(v * height, 0.f, height - 1.f));
+            const uint32_t texel = texels[static_cast<size_t>(ty) * textureWidth + tx];
+
+            if (sdf) {
+                a *= smoothstep(edge0, edge1, channel(texel, 24) / 255.f);
+            } else {
+                r *= channel(texel, 0) / 255.f;
+                g *= channel(texel, 8) / 255.f;
+                b *= channel(texel, 16) / 255.f;
+                a *= channel(texel, 24) / 255.f;
+            }
+        }
+
+        a = clamp01(a);
+        if (a <= 0.f) {
+            continue;
+        }
+
+        const uint32_t dst = row[x];
+        const float srcScale = a * 255.f;
+        const float dstScale = 1.f - a;
+        auto blend = [&](float src, unsigned shift) {
+            return static_cast<uint32_t>(
+                std::lrint(clamp01(src) * srcScale + channel(dst, shift) * dstScale));
+        };
+
+        row[x] = blend(r, 0) | (blend(g, 8) << 8) | (blend(b, 16) << 16) |
+                 (static_cast<uint32_t>(std::lrint(srcScale + channel(dst, 24) * dstScale)) << 24);
+    }
+}
+
+void SoftwareRenderer::present() {
+    if (!m_windowContext || m_framebuffer.empty()) {
+        return;
+    }
+
+    SDL_Window* window = m_windowContext->GetWindow();
+    SDL_Surface* windowSurface = SDL_GetWindowSurface(window);
+    if (!windowSurface) {
+        return;
+    }
+
+    SDL_Surface* frame =
+        SDL_CreateRGBSurfaceWithFormatFrom(m_framebuffer.data(), m_size.x, m_size.y, 32,
+                                           m_size.x * sizeof(uint32_t), SDL_PIXELFORMAT_RGBA32);
+    if (!frame) {
+        Logger::Error("SoftwareRenderer: Failed to create frame surface: {}", SDL_GetError());
+        return;
+    }
+
+    // Copy, the framebuffer is already blended
+    SDL_SetSurfaceBlendMode(frame, SDL_BLENDMODE_NONE);
+    SDL_BlitSurface(frame, nullptr, windowSurface, nullptr);
+    SDL_FreeSurface(frame);
+
+    SDL_UpdateWindowSurface(window);
+}
+
+} // namespace Arclight::Rendering
@@ -0,0 +1,230 @@
+#pragma once
+
+#include <Arclight/Graphics/Rendering/HandleTable.h>
+#include <Arclight/Graphics/Rendering/Pipeline.h>
+#include <Arclight/Graphics/Rendering/Renderer.h>
+#include <Arclight/Graphics/Rendering/Shader.h>
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Width and height of a framebuffer tile in pixels, each tile is rasterised by one job
+#define SOFTWARERENDERER_TILE_SIZE 64
+// Triangles per triangle setup job
+#define SOFTWARERENDERER_SETUP_GRAIN_SIZE 1024
+// Distance field spread in texels, must match the spread of SDF glyph caches
+#define SOFTWARERENDERER_SDF_SPREAD 8
+// Initial size of the transient memory block in bytes, grows to fit the largest frame
+#define SOFTWARERENDERER_TRANSIENT_BLOCK_SIZE (256 * 1024)
+
+namespace Arclight::Rendering {
+
+////////////////////////////////////////
+/// \brief CPU rasteriser, renders without a GPU
+///
+/// Draw calls are transformed to screen space as render() issues them,
+/// then the framebuffer is split into tiles which are rasterised in parallel on the ThreadPool.
+/// Triangles are drawn in the order render() issues them, alpha blended over the framebuffer.
+/// There is no depth buffer, render() already issues draws back to front.
+///
+/// Shaders can not run on the CPU, pipelines created with custom shaders
+/// are shaded like the default pipeline.
+///
+/// Can be initialized without a window for headless rendering,
+/// set the framebuffer size with resize_viewport().
+/// When the ARCLIGHT_SOFTWARE_FRAME_DUMP environment variable is set to a directory,
+/// every frame is saved to it as a PNG.
+////////////////////////////////////////
+class SoftwareRenderer final : public Renderer {
+public:
+    SoftwareRenderer() = default;
+    ~SoftwareRenderer() override;
+
+    ////////////////////////////////////////
+    /// \param context Window to present to, may be nullptr
+    ////////////////////////////////////////
+    int initialize(class WindowContext* context) override;
+
+    void wait_device_idle() const override {}
+
+    void render() override;
+
+    void resize_viewport(const Vector2i& newPixelSize) override;
+
+    RenderPipeline::PipelineHandle
+    create_pipeline(const Shader&, const Shader&,
+                    const RenderPipeline::PipelineFixedConfig& config) override;
+
+    void destroy_pipeline(RenderPipeline::PipelineHandle handle) override;
+    bool pipeline_valid(RenderPipeline::PipelineHandle handle) const override {
+        return m_pipelines.contains(handle);
+    }
+    RenderPipeline& default_pipeline() override { return *m_defaultPipeline; }
+    // Primitive type is taken from the pipeline, triangle lists are only used by draw_quads
+    RenderPipeline& default_batch_pipeline() override { return *m_defaultPipeline; }
+    RenderPipeline& default_instanced_pipeline() override { return *m_defaultInstancedPipeline; }
+    RenderPipeline& default_sdf_pipeline() override { return *m_defaultSDFPipeline; }
+    RenderPipeline& default_sdf_instanced_pipeline() override {
+        return *m_defaultSDFInstancedPipeline;
+    }
+
+    void bind_pipeline(RenderPipeline::PipelineHandle pipeline) override;
+    void bind_texture(Texture::TextureHandle texture) override;
+    void bind_vertex_buffer(void* buffer) override;
+
+    void* allocate_vertex_buffer(unsigned vertexCount) override;
+    void update_vertex_buffer(void* buffer, unsigned int offset, unsigned int size,
+                              const Vertex* vertices) override;
+    void* get_vertex_buffer_mapping(void* buffer) override;
+    void destroy_vertex_buffer(void* buffer) override;
+
+    // Draws are rasterised before render() returns, so one region is reused every frame
+    TransientAllocation allocate_transient(size_t size) override;
+    TransientBlock create_transient_block(size_t size) override;
+    void destroy_transient_block(const TransientBlock& block) override;
+
+    Texture::TextureHandle allocate_texture(const Vector2u& size, Texture::Format format) override;
+    void update_texture(Texture::TextureHandle texture, const void* data) override;
+    void destroy_texture(Texture::TextureHandle texture) override;
+
+    const std::string& get_name() const override { return m_name; }
+
+    ////////////////////////////////////////
+    /// \brief Save the last rendered frame as a PNG
+    ///
+    /// \return true on success
+    ////////////////////////////////////////
+    bool save_png(const std::string& path) const;
+
+    ////////////////////////////////////////
+    /// \brief Pixels of the last rendered frame
+    ///
+    /// RGBA8 with red in the lowest byte, rows from top to bottom without padding.
+    ////////////////////////////////////////
+    inline const uint32_t* framebuffer() const { return m_framebuffer.data(); }
+    inline const Vector2i& framebuffer_size() const { return m_size; }
+
+private:
+    enum Shading {
+        ShadingDefault, // Vertex colour multiplied by the texture
+        ShadingSDF,     // Texture alpha is a signed distance field, see default_sdf_pipeline()
+    };
+
+    struct SoftwarePipeline {
+        Shading shading;
+        RenderPipeline::PrimitiveType topology;
+        RenderPipeline::VertexLayout vertexLayout;
+    };
+
+    struct SoftwareTexture {
+        Vector2u size;
+        Texture::Format format;
+        // Every format is expanded to RGBA8, alpha only textures to white
+        std::vector<uint32_t> texels;
+    };
+
+    struct SoftwareVertexBuffer {
+        std::vector<Vertex> vertices;
+        void* handle = nullptr;
+    };
+
+    // Vertex transformed to framebuffer pixels
+    struct ScreenVertex {
+        float x, y;
+        float u, v;
+        float r, g, b, a;
+    };
+
+    // Texture and shading of a draw call, shared by its triangles
+    struct DrawState {
+        const SoftwareTexture* texture;
+        Shading shading;
+    };
+
+    struct Triangle {
+        uint32_t vertices[3]; // Into m_vertices
+        uint32_t state;       // Into m_drawStates
+    };
+
+    // Edge functions and attribute planes of a triangle,
+    // a plane p gives p[0] * x + p[1] * y + p[2] at pixel coordinates x, y
+    struct TriangleSetup {
+        float edges[3][3];  // Positive inside the triangle
+        float planes[6][3]; // u, v, r, g, b, a
+        int minX, minY, maxX, maxY; // Bounds in pixels clipped to the framebuffer, max exclusive
+        float sdfWidth;             // Distance covered by one pixel for SDF shading
+        bool repeat;                // Texture coordinates leave [0, 1] and have to be wrapped
+        uint32_t state;
+    };
+
+    // Transform vertices of a draw call to screen space and add them to m_vertices,
+    // returns the index of the first one
+    uint32_t add_vertices(const Vertex* vertices, unsigned vertexCount, const Matrix4& transform,
+                          const Matrix4& view);
+    uint32_t add_draw_state();
+
+    void do_draw_call(unsigned firstVertex, unsigned vertexCount, const Matrix4& transform,
+                      const Matrix4& view) override;
+    void do_draw_indexed_call(unsigned firstVertex, unsigned indexCount, const Matrix4& transform,
+                              const Matrix4& view) override;
+    void upload_instances(const SpriteInstance* instances, unsigned instanceCount) override;
+    void do_draw_instanced_call(unsigned firstInstance, unsigned instanceCount,
+                                const Matrix4& view) override;
+
+    // Returns false if the triangle covers no pixels
+    bool setup_triangle(const Triangle& triangle, TriangleSetup& setup) const;
+    void rasterise_tile(unsigned tile);
+    void shade_span(uint32_t* row, int begin, int end, float y, const TriangleSetup& setup) const;
+
+    void present();
+
+    WindowContext* m_windowContext = nullptr;
+
+    Vector2i m_size = {0, 0};
+    Vector2i m_tileCount = {0, 0};
+    std::vector<uint32_t> m_framebuffer;
+    uint32_t m_clearColour = 0xff000000;
+
+    // Frame geometry, cleared every frame, capacity is kept
+    std::vector<ScreenVertex> m_vertices;
+    std::vector<Triangle> m_triangles;
+    std::vector<TriangleSetup> m_setups;
+    std::vector<DrawState> m_drawStates;
+    // Triangle setups overlapping each tile, in draw order
+    std::vector<std::vector<uint32_t>> m_bins;
+
+    // Instances of the frame, copied by upload_instances
+    std::vector<SpriteInstance> m_instances;
+
+    SoftwarePipeline* m_boundPipeline = nullptr;
+    SoftwareTexture* m_boundTexture = nullptr;
+    SoftwareVertexBuffer* m_boundVertexBuffer = nullptr;
+
+    // Resources may be created and destroyed from any thread
+    std::mutex m_resourceLock;
+    HandleTable<SoftwarePipeline> m_pipelines;
+    HandleTable<SoftwareTexture> m_textures;
+    HandleTable<SoftwareVertexBuffer> m_vertexBuffers;
+
+    // Transient memory, reset by render() once the frame no longer reads it
+    std::mutex m_transientLock;
+    TransientChain m_transientChain{SOFTWARERENDERER_TRANSIENT_BLOCK_SIZE};
+    // Tagged apart from m_vertexBuffers as both are bound through bind_vertex_buffer()
+    HandleTable<SoftwareVertexBuffer> m_transientBuffers{1};
+
+    // Directory every frame is saved to, empty when not dumping frames
+    std::string m_frameDumpPath;
+    unsigned long long m_frameCounter = 0;
+
+    const std::string m_name = "Software";
+
+    std::unique_ptr<RenderPipeline> m_defaultPipeline;
+    std::unique_ptr<RenderPipeline> m_defaultInstancedPipeline;
+    std::unique_ptr<RenderPipeline> m_defaultSDFPipeline;
+    std::unique_ptr<RenderPipeline> m_defaultSDFInstancedPipeline;
+};
+
+} // namespace Arclight::Rendering
@@ -12,28 +12,34 @@ namespace Arclight::Rendering {
 VulkanPipeline::VulkanPipeline(VulkanRenderer& renderer, const Shader& vertexShader,
                                const Shader& fragmentShader,
                                const RenderPipeline::PipelineFixedConfig& config)
-    : m_renderer(renderer), m_device(renderer.GetDevice()), m_renderPass(renderer.GetRenderPass()) {
+    : m_renderer(renderer), m_device(renderer.GetDevice()), m_renderPass(renderer.GetRenderPass()),
+      m_bindless(config.bindlessTextures) {
     assert(m_device != VK_NULL_HANDLE);
     assert(m_renderPass != VK_NULL_HANDLE);
 
     assert(vertexShader.GetStage() == Shader::VertexShader);
     assert(fragmentShader.GetStage() == Shader::FragmentShader);
 
-    /*VkPushConstantRange pushConstant2D = {
+    if (m_bindless && !m_renderer.has_bindless_textures()) {
+        FatalRuntimeError("[Fatal error] VulkanPipeline::VulkanPipeline: bindless textures are not "
+                          "supported by the GPU!");
+    }
+
+    VkPushConstantRange pushConstant2D = {
         .stageFlags = VK_SHADER_STAGE_VERTEX_BIT,
         .offset = 0,
         .size = sizeof(PushConstant2DTransform),
-    };*/
+    };
 
     VkPipelineLayoutCreateInfo vkPipelineLayoutCreateInfo = {
         .sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO,
         .pNext = nullptr,
         .flags = 0,
-        .setLayoutCount = 2,
-        .pSetLayouts = m_renderer.m_descriptorSetLayouts,
-        .pushConstantRangeCount = 0,
-        .pPushConstantRanges = nullptr,
-        //.pPushConstantRanges = &pushConstant2D,
+        .setLayoutCount = m_bindless ? 1u : 2u,
+        .pSetLayouts =
+            m_bindless ? &m_renderer.m_bindlessSetLayout : m_renderer.m_descriptorSetLayouts,
+        .pushConstantRangeCount = 1,
+        .pPushConstantRanges = &pushConstant2D,
     };
 
     if (vkCreatePipelineLayout(m_device, &vkPipelineLayoutCreateInfo, nullptr, &m_pipelineLayout)) {
@@ -51,6 +57,13 @@ VulkanPipeline::VulkanPipeline(VulkanRenderer& renderer, const Shader& vertexSha
         .pVertexAttributeDescriptions = m_attributeDescriptions,
     };
 
+    if (config.vertexLayout == RenderPipeline::VertexLayoutSpriteInstance) {
+        vertexInputInfo.vertexBindingDescriptionCount = 2;
+        vertexInputInfo.pVertexBindingDescriptions = m_instanceBindings;
+        vertexInputInfo.vertexAttributeDescriptionCount = m_bindless ? 6u : 5u;
+        vertexInputInfo.pVertexAttributeDescriptions = m_instanceAttributeDescriptions;
+    }
+
     VkPipelineInputAssemblyStateCreateInfo inputAssembly = inputAssemblyStateDefault;
     inputAssembly.topology = ToVkPrimitiveTopology(config.topology);
 
@@ -156,8 +169,9 @@ VulkanPipeline::VulkanPipeline(VulkanRenderer& renderer, const Shader& vertexSha
         .basePipelineIndex = 0,
     };
 
-    if (vkCreateGraphicsPipelines(m_device, VK_NULL_HANDLE, 1, &gfxPipelineCreateInfo, nullptr,
-                                  &m_pipeline) != VK_SUCCESS) {
+    // Every pipeline shares the renderer's cache so later launches skip compilation
+    if (vkCreateGraphicsPipelines(m_device, m_renderer.GetPipelineCache(), 1,
+                                  &gfxPipelineCreateInfo, nullptr, &m_pipeline) != VK_SUCCESS) {
         FatalRuntimeError("VulkanRenderer::initialize: Failed to create Vulkan graphics pipeline!");
     }
 
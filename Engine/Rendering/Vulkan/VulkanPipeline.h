@@ -1,6 +1,7 @@
 #pragma once
 
 #include <Arclight/Graphics/Rendering/Pipeline.h>
+#include <Arclight/Graphics/Rendering/SpriteInstance.h>
 #include <Arclight/Graphics/Vertex.h>
 
 #include <vulkan/vulkan_core.h>
@@ -13,14 +14,20 @@ public:
         float viewport[16];  // mat4 viewport
         float canvas[16];
         float transform[16]; // mat4 transform
+        uint32_t textureIndex; // Slot in the bindless texture table, bindless pipelines only
     };
 
+    // textureIndex of instanced bindless pipelines sampling the texture of each instance
+    static constexpr uint32_t InstanceTextureIndex = UINT32_MAX;
+
     VulkanPipeline(class VulkanRenderer& renderer, const Shader& vertexShader,
                    const Shader& fragmentShader, const RenderPipeline::PipelineFixedConfig& config);
     ~VulkanPipeline();
 
     inline VkPipeline GetPipelineHandle() { return m_pipeline; }
     inline VkPipelineLayout PipelineLayout() { return m_pipelineLayout; }
+    // Samples the bindless texture table instead of a descriptor set per texture
+    inline bool Bindless() const { return m_bindless; }
 
     void UpdatePushConstant(VkCommandBuffer commandBuffer, uint32_t offset, uint32_t size,
                             const void* data);
@@ -39,6 +46,8 @@ private:
     VkPipelineLayout m_pipelineLayout = VK_NULL_HANDLE;
     VkPipeline m_pipeline = VK_NULL_HANDLE;
 
+    bool m_bindless = false;
+
     VkVertexInputBindingDescription m_binding = {
         .binding = 0,                             // Index of the binding
         .stride = sizeof(Vertex),                 // Bytes from one entry to next
@@ -72,6 +81,58 @@ private:
             .offset = (offsetof(Vertex, colour)),
         }};
 
+    // VertexLayoutSpriteInstance, binding 0 is the unit quad and binding 1 the instance buffer
+    VkVertexInputBindingDescription m_instanceBindings[2] = {
+        {
+            .binding = 0,
+            .stride = 2 * sizeof(float),
+            .inputRate = VK_VERTEX_INPUT_RATE_VERTEX,
+        },
+        {
+            .binding = 1,
+            .stride = sizeof(SpriteInstance),
+            .inputRate = VK_VERTEX_INPUT_RATE_INSTANCE, // Next data entry after each instance
+        }};
+
+    // The texture index is only read by bindless pipelines
+    VkVertexInputAttributeDescription m_instanceAttributeDescriptions[6] = {
+        {
+            .location = 0,
+            .binding = 0,
+            .format = VK_FORMAT_R32G32_SFLOAT,
+            .offset = 0,
+        },
+        {
+            .location = 1,
+            .binding = 1,
+            .format = VK_FORMAT_R32G32B32A32_SFLOAT,
+            .offset = (offsetof(SpriteInstance, transform)),
+        },
+        {
+            .location = 2,
+            .binding = 1,
+            .format = VK_FORMAT_R32G32B32_SFLOAT,
+            .offset = (offsetof(SpriteInstance, translation)),
+        },
+        {
+            .location = 3,
+            .binding = 1,
+            .format = VK_FORMAT_R8G8B8A8_UNORM, // Packed RGBA8, red in the lowest byte
+            .offset = (offsetof(SpriteInstance, colour)),
+        },
+        {
+            .location = 4,
+            .binding = 1,
+            .format = VK_FORMAT_R32G32B32A32_SFLOAT,
+            .offset = (offsetof(SpriteInstance, uvRect)),
+        },
+        {
+            .location = 5,
+            .binding = 1,
+            .format = VK_FORMAT_R32_UINT,
+            .offset = (offsetof(SpriteInstance, textureIndex)),
+        }};
+
     static const VkPipelineVertexInputStateCreateInfo vertexInputStateDefault;
     static const VkPipelineInputAssemblyStateCreateInfo inputAssemblyStateDefault;
     static const VkPipelineMultisampleStateCreateInfo multisampleStateDefault;
@@ -4,28 +4,85 @@
 #include "VulkanMemory.h"
 
 #include <Arclight/Core/Fatal.h>
+#include <Arclight/Core/File.h>
 #include <Arclight/Core/Logger.h>
 #include <Arclight/Core/ResourceManager.h>
+#include <Arclight/Platform/Platform.h>
 
 #include <SDL_vulkan.h>
+#include <algorithm>
 #include <assert.h>
+#include <string.h>
 
 namespace Arclight::Rendering {
 
 #include "DefaultShaderBytecode.h"
 
+namespace {
+
+// Written in front of the data returned by vkGetPipelineCacheData
+struct PipelineCacheFileHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t vendorID;
+    uint32_t deviceID;
+    uint32_t driverVersion;
+    uint8_t deviceUUID[VK_UUID_SIZE];
+    uint64_t dataSize;
+};
+
+const uint32_t pipelineCacheMagic = 0x4350564B; // 'KVPC'
+
+// Header identifying the device and driver pipelines are compiled for
+PipelineCacheFileHeader pipeline_cache_header(VkPhysicalDevice gpu) {
+    VkPhysicalDeviceIDProperties idProperties = {};
+    idProperties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ID_PROPERTIES;
+
+    VkPhysicalDeviceProperties2 properties2 = {};
+    properties2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2;
+    properties2.pNext = &idProperties;
+
+    vkGetPhysicalDeviceProperties2(gpu, &properties2);
+
+    // Zero the padding too, the header is written as is
+    PipelineCacheFileHeader header;
+    memset(&header, 0, sizeof(header));
+
+    header.magic = pipelineCacheMagic;
+    header.version = RENDERING_VULKANRENDERER_PIPELINE_CACHE_VERSION;
+    header.vendorID = properties2.properties.vendorID;
+    header.deviceID = properties2.properties.deviceID;
+    header.driverVersion = properties2.properties.driverVersion;
+    memcpy(header.deviceUUID, idProperties.deviceUUID, VK_UUID_SIZE);
+    return header;
+}
+
+} // namespace
+
 VulkanRenderer::~VulkanRenderer() {
     Logger::Debug("Destroying VulkanRenderer");
 
     EndRenderPass();
     EndFrame();
 
-    vkQueueWaitIdle(m_graphicsQueue);
+    {
+        std::scoped_lock lockQueue(m_queueLock);
+        vkQueueWaitIdle(m_graphicsQueue);
+    }
+
+    // Waits for the uploads still in flight
+    m_uploader.reset();
+    vkDestroySemaphore(m_device, m_frameTimeline, nullptr);
 
     DestroyDepthBuffer();
 
     vkDestroyDescriptorPool(m_device, m_textureDescriptorPool->handle, nullptr);
 
+    if (m_bindlessTextures) {
+        vkDestroyDescriptorPool(m_device, m_bindlessPool, nullptr);
+        vkDestroyDescriptorSetLayout(m_device, m_bindlessSetLayout, nullptr);
+    }
+
     for (int i = 0; i < RENDERING_VULKANRENDERER_MAX_FRAMES_IN_FLIGHT; i++) {
         Frame& frame = m_frames[i];
 
@@ -42,21 +99,34 @@ VulkanRenderer::~VulkanRenderer() {
     vkDestroyDescriptorSetLayout(m_device, m_descriptorSetLayouts[0], nullptr);
     vkDestroyDescriptorSetLayout(m_device, m_descriptorSetLayouts[1], nullptr);
 
-    for (VulkanTexture* texture : m_textures) {
-        delete texture;
-    }
+    m_textures.for_each([](VulkanTexture* texture) { delete texture; });
+    delete m_whiteTexture;
 
-    for (VertexBuffer* vBuf : m_vertexBuffers) {
+    m_vertexBuffers.for_each([this](VertexBuffer* vBuf) {
         _destroy_vertex_buffer(vBuf);
         delete vBuf;
+    });
+
+    if (m_quadIndexBuffer) {
+        vmaDestroyBuffer(m_alloc, m_quadIndexBuffer, m_quadIndexAllocation);
+    }
+
+    if (m_unitQuadBuffer) {
+        vmaDestroyBuffer(m_alloc, m_unitQuadBuffer, m_unitQuadAllocation);
+    }
+
+    for (Frame& frame : m_frames) {
+        frame.transientChain.destroy(*this);
     }
 
     {
         std::scoped_lock lockBufferDestruction(m_bufferDestroyLock);
-        for (auto& buffer : m_buffersPendingDestruction) {
-            vmaDestroyBuffer(m_alloc, buffer.first, buffer.second);
+        for (auto& pending : m_buffersPendingDestruction) {
+            for (auto& buffer : pending) {
+                vmaDestroyBuffer(m_alloc, buffer.first, buffer.second);
+            }
+            pending.clear();
         }
-        m_buffersPendingDestruction.clear();
     }
 
     vmaDestroyAllocator(m_alloc);
@@ -65,20 +135,38 @@ VulkanRenderer::~VulkanRenderer() {
         vkDestroyFramebuffer(m_device, fb, nullptr);
     }
 
-    for (VulkanPipeline* pipeline : m_pipelines) {
-        delete pipeline;
-    }
+    m_pipelines.for_each([](VulkanPipeline* pipeline) { delete pipeline; });
     vkDestroyRenderPass(m_device, m_renderPass, nullptr);
 
     if (m_defaultPipeline) {
         delete m_defaultPipeline;
     }
 
+    if (m_defaultBatchPipeline) {
+        delete m_defaultBatchPipeline;
+    }
+
+    if (m_defaultInstancedPipeline) {
+        delete m_defaultInstancedPipeline;
+    }
+
+    if (m_defaultSDFPipeline) {
+        delete m_defaultSDFPipeline;
+    }
+
+    if (m_defaultSDFInstancedPipeline) {
+        delete m_defaultSDFInstancedPipeline;
+    }
+
     for (VkImageView v : m_imageViews) {
         vkDestroyImageView(m_device, v, nullptr);
     }
 
     vkDestroySwapchainKHR(m_device, m_swapchain, nullptr);
+
+    SavePipelineCache();
+    vkDestroyPipelineCache(m_device, m_pipelineCache, nullptr);
+
     vkDestroyDevice(m_device, nullptr);
 
     assert(s_rendererInstance == this);
@@ -135,6 +223,8 @@ int VulkanRenderer::initialize(WindowContext* windowContext) {
         return -6;
     }
 
+    LoadPipelineCache();
+
     // Create Vulkan surface with SDL
     if (!SDL_Vulkan_CreateSurface(sdlWindow, m_instance, &m_surface)) {
         Logger::Error("VulkanRenderer::initialize: Failed to create SDL Vulkan surface!");
@@ -166,6 +256,27 @@ int VulkanRenderer::initialize(WindowContext* windowContext) {
 
     vkCheck(vmaCreateAllocator(&allocatorInfo, &m_alloc));
 
+    {
+        VkSemaphoreTypeCreateInfo timelineInfo = {
+            .sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO,
+            .pNext = nullptr,
+            .semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE,
+            .initialValue = 0,
+        };
+
+        VkSemaphoreCreateInfo timelineSemaphoreInfo = {
+            .sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO,
+            .pNext = &timelineInfo,
+            .flags = 0,
+        };
+
+        vkCheck(vkCreateSemaphore(m_device, &timelineSemaphoreInfo, nullptr, &m_frameTimeline));
+    }
+
+    m_uploader = std::make_unique<VulkanUploader>(m_device, m_alloc, m_transferQueue,
+                                                  m_transferQueueFamily, m_queueLock,
+                                                  m_frameTimeline);
+
     SwapChainInfo scInfo = GetSwapChainInfo();
     assert(scInfo.presentModes.size() && scInfo.surfaceFormats.size());
 
@@ -411,6 +522,19 @@ int VulkanRenderer::initialize(WindowContext* windowContext) {
 
     create_descriptor_set_layouts();
 
+    if (m_bindlessTextures) {
+        create_bindless_texture_table();
+
+        // Takes slot 0, which instances sample until they are given a texture
+        const uint32_t white = 0xffffffff;
+        m_whiteTexture = new VulkanTexture(*this, {1, 1}, VK_FORMAT_R8G8B8A8_SRGB);
+        {
+            std::scoped_lock lockResources(m_resourceLock);
+            add_bindless_texture(m_whiteTexture);
+        }
+        upload_texture(m_whiteTexture, &white);
+    }
+
     VkDescriptorPoolSize poolSizes[2] = {
         {
             .type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC,
@@ -436,12 +560,49 @@ int VulkanRenderer::initialize(WindowContext* windowContext) {
     };
 
     {
-        Shader vertShader(Shader::VertexShader, defaultVertexShaderData);
-        Shader fragShader(Shader::FragmentShader, defaultFragmentShaderData);
+        // The default pipelines sample the bindless texture table where there is one
+        const bool bindless = m_bindlessTextures;
+        Shader vertShader(Shader::VertexShader,
+                          bindless ? bindlessVertexShaderData : defaultVertexShaderData);
+        Shader fragShader(Shader::FragmentShader,
+                          bindless ? bindlessFragmentShaderData : defaultFragmentShaderData);
+
+        RenderPipeline::PipelineFixedConfig config = RenderPipeline::defaultConfig;
+        config.bindlessTextures = bindless;
+
+        m_defaultPipeline = new RenderPipeline(vertShader, fragShader, config);
+
+        // Vulkan pipelines have a fixed topology, draw_quads needs a triangle list
+        RenderPipeline::PipelineFixedConfig batchConfig = config;
+        batchConfig.topology = RenderPipeline::PrimitiveTriangleList;
+
+        m_defaultBatchPipeline = new RenderPipeline(vertShader, fragShader, batchConfig);
+
+        Shader instancedVertShader(Shader::VertexShader,
+                                   bindless ? bindlessInstancedVertexShaderData
+                                            : defaultInstancedVertexShaderData);
 
-        m_defaultPipeline = new RenderPipeline(vertShader, fragShader);
+        RenderPipeline::PipelineFixedConfig instancedConfig = config;
+        instancedConfig.vertexLayout = RenderPipeline::VertexLayoutSpriteInstance;
+
+        m_defaultInstancedPipeline =
+            new RenderPipeline(instancedVertShader, fragShader, instancedConfig);
+
+        Shader sdfFragShader(Shader::FragmentShader,
+                             bindless ? bindlessSDFFragmentShaderData
+                                      : defaultSDFFragmentShaderData);
+
+        m_defaultSDFPipeline = new RenderPipeline(vertShader, sdfFragShader, batchConfig);
+        m_defaultSDFInstancedPipeline =
+            new RenderPipeline(instancedVertShader, sdfFragShader, instancedConfig);
     }
 
+    // Every instance is drawn as this quad, in triangle strip order
+    const float unitQuad[8] = {0.f, 1.f, 0.f, 0.f, 1.f, 1.f, 1.f, 0.f};
+    memcpy(create_mapped_buffer(sizeof(unitQuad), VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
+                                m_unitQuadBuffer, m_unitQuadAllocation),
+           unitQuad, sizeof(unitQuad));
+
     for (int i = 0; i < RENDERING_VULKANRENDERER_MAX_FRAMES_IN_FLIGHT; i++) {
         Frame& frame = m_frames[i];
 
@@ -456,6 +617,7 @@ int VulkanRenderer::initialize(WindowContext* windowContext) {
         frame.uboDescriptorPool = std::unique_ptr<DescriptorPool>(create_descriptor_pool(&poolSizes[0], 1, 200, m_descriptorSetLayouts[0]));
 
         m_lastTextures[i] = nullptr;
+        m_lastVertexBuffers[i] = nullptr;
     }
 
     BeginFrame();
@@ -468,37 +630,49 @@ VulkanRenderer::create_pipeline(const Shader& vertexShader, const Shader& fragme
                                 const RenderPipeline::PipelineFixedConfig& config) {
     VulkanPipeline* pipeline = new VulkanPipeline(*this, vertexShader, fragmentShader, config);
 
-    m_pipelines.insert(pipeline);
-
-    return pipeline;
+    std::scoped_lock lockResources(m_resourceLock);
+    return m_pipelines.insert(pipeline);
 }
 
 void VulkanRenderer::destroy_pipeline(RenderPipeline::PipelineHandle handle) {
-    Renderer::destroy_pipeline(handle);
+    VulkanPipeline* pipeline;
+    {
+        std::scoped_lock lockResources(m_resourceLock);
+        pipeline = m_pipelines.erase(handle);
+    }
+
+    if (!pipeline) {
+        Logger::Warning("VulkanRenderer: Invalid pipeline handle {}.", handle);
+        return;
+    }
 
-    size_t erased = m_pipelines.erase(reinterpret_cast<VulkanPipeline*>(handle));
-    assert(erased ==
-           1); // Erase returns the amount of pipelines erased, ensure that this is exactly 1
+    if (m_boundPipeline == pipeline) {
+        m_boundPipeline = nullptr;
+    }
 
-    delete reinterpret_cast<VulkanPipeline*>(handle);
+    delete pipeline;
 }
 
 Texture::TextureHandle VulkanRenderer::allocate_texture(const Vector2u& bounds,
                                                         Texture::Format format) {
     VulkanTexture* texture = new VulkanTexture(*this, bounds, TextureToVkFormat(format));
 
-    m_textures.insert(texture);
+    std::scoped_lock lockResources(m_resourceLock);
+    if (m_bindlessTextures) {
+        add_bindless_texture(texture);
+    }
 
-    return texture;
+    return m_textures.insert(texture);
 }
 
 void VulkanRenderer::update_texture(Texture::TextureHandle texture, const void* data) {
-    assert(m_textures.contains(reinterpret_cast<VulkanTexture*>(texture)));
-
-    VulkanTexture* vkTex = reinterpret_cast<VulkanTexture*>(texture);
+    VulkanTexture* tex = m_textures.get(texture);
+    if (!tex) {
+        Logger::Warning("VulkanRenderer: Invalid texture handle {}.", texture);
+        return;
+    }
 
-    vkTex->UpdateTextureBuffer(data);
-    vkTex->UpdateTextureImage();
+    upload_texture(tex, data);
 }
 
 void VulkanRenderer::destroy_texture(Texture::TextureHandle texture) {
@@ -506,10 +680,16 @@ void VulkanRenderer::destroy_texture(Texture::TextureHandle texture) {
         return;
     }
 
-    VulkanTexture* tex = reinterpret_cast<VulkanTexture*>(texture);
-    size_t erased = m_textures.erase(tex);
-    assert(erased ==
-           1); // Erase returns the amount of pipelines erased, ensure that this is exactly 1
+    VulkanTexture* tex;
+    {
+        std::scoped_lock lockResources(m_resourceLock);
+        tex = m_textures.erase(texture);
+    }
+
+    if (!tex) {
+        Logger::Warning("VulkanRenderer: Invalid texture handle {}.", texture);
+        return;
+    }
 
     for (unsigned i = 0; i < RENDERING_VULKANRENDERER_MAX_FRAMES_IN_FLIGHT; i++) {
         if (auto it = m_textureDescriptorSets.find(tex); it != m_textureDescriptorSets.end()) {
@@ -517,33 +697,76 @@ void VulkanRenderer::destroy_texture(Texture::TextureHandle texture) {
             m_textureDescriptorSets.erase(it);
         }
 
-        if (m_lastTextures[i] == texture) {
+        if (m_lastTextures[i] == tex) {
             m_lastTextures[i] = nullptr; // Invalidate m_lastTexture if relevant
         }
     }
 
-    delete reinterpret_cast<VulkanTexture*>(texture);
+    if (m_boundTexture == tex) {
+        m_boundTexture = nullptr;
+    }
+
+    if (tex->m_uploadValue > m_uploader->submitted_value()) {
+        // The open batch references the image
+        m_uploader->flush();
+    }
+
+    // Waits for the device to be idle, so nothing can still sample the slot
+    const bool hasBindlessSlot = tex->m_hasBindlessSlot;
+    const uint32_t bindlessIndex = tex->m_bindlessIndex;
+    delete tex;
+
+    if (hasBindlessSlot) {
+        std::scoped_lock lockResources(m_resourceLock);
+        m_freeBindlessSlots.push_back(bindlessIndex);
+    }
+}
+
+uint32_t VulkanRenderer::bindless_texture_index(Texture::TextureHandle texture) const {
+    const VulkanTexture* tex = m_textures.get(texture);
+    if (!tex) {
+        return m_whiteTexture ? m_whiteTexture->m_bindlessIndex : 0;
+    }
+
+    return tex->m_bindlessIndex;
+}
+
+void VulkanRenderer::upload_texture(VulkanTexture* texture, const void* data) {
+    // Frames sampling the texture of each instance may sample any texture
+    const uint64_t waitFrame =
+        std::max(texture->m_lastUseFrame.load(std::memory_order_relaxed),
+                 m_instanceTextureFrame.load(std::memory_order_relaxed));
+    texture->m_uploadValue.store(m_uploader->upload_image(texture->m_image, texture->m_bounds,
+                                                          texture->TexelSize(), data, waitFrame),
+                                 std::memory_order_relaxed);
 }
 
 void* VulkanRenderer::allocate_vertex_buffer(unsigned vertexCount) {
     VertexBuffer* obj = new VertexBuffer;
     _create_vertex_buffer(obj, vertexCount);
 
-    m_vertexBuffers.insert(obj);
-
-    return obj;
+    std::scoped_lock lockResources(m_resourceLock);
+    obj->handle = m_vertexBuffers.insert(obj);
+    return obj->handle;
 }
 
 void VulkanRenderer::update_vertex_buffer(void* buffer, unsigned int offset, unsigned int size, const Vertex* data) {
-    VertexBuffer* obj = (VertexBuffer*)buffer;
+    VertexBuffer* obj = m_vertexBuffers.get(buffer);
+    if (!obj) {
+        Logger::Warning("VulkanRenderer: Invalid vertex buffer handle {}.", buffer);
+        return;
+    }
 
     assert(offset + size < obj->size);
     memcpy(obj->hostMapping + offset * sizeof(Vertex), data, size * sizeof(Vertex));
 }
 
 void* VulkanRenderer::get_vertex_buffer_mapping(void* buffer) {
-    VertexBuffer* obj = (VertexBuffer*)buffer;
-    assert(m_vertexBuffers.contains(obj));
+    VertexBuffer* obj = m_vertexBuffers.get(buffer);
+    if (!obj) {
+        Logger::Warning("VulkanRenderer: Invalid vertex buffer handle {}.", buffer);
+        return nullptr;
+    }
 
     return obj->hostMapping;
 }
@@ -551,20 +774,37 @@ void* VulkanRenderer::get_vertex_buffer_mapping(void* buffer) {
 void VulkanRenderer::destroy_vertex_buffer(void* buffer) {
     assert(buffer);
 
-    VertexBuffer* obj = (VertexBuffer*)buffer;
-    size_t erased = m_vertexBuffers.erase(obj);
-    assert(erased ==
-           1); // Erase returns the amount of pipelines erased, ensure that this is exactly 1
+    VertexBuffer* obj;
+    {
+        std::scoped_lock lockResources(m_resourceLock);
+        obj = m_vertexBuffers.erase(buffer);
+    }
+
+    if (!obj) {
+        Logger::Warning("VulkanRenderer: Invalid vertex buffer handle {}.", buffer);
+        return;
+    }
 
     if (m_boundVertexBuffer == obj) {
         m_boundVertexBuffer = nullptr;
     }
 
+    for (unsigned i = 0; i < RENDERING_VULKANRENDERER_MAX_FRAMES_IN_FLIGHT; i++) {
+        if (m_lastVertexBuffers[i] == obj) {
+            m_lastVertexBuffers[i] = nullptr;
+        }
+    }
+
     _destroy_vertex_buffer(obj);
 
     delete obj;
 }
 
+Renderer::TransientAllocation VulkanRenderer::allocate_transient(size_t size) {
+    std::scoped_lock lockTransient(m_transientLock);
+    return m_frames[m_currentFrame].transientChain.allocate(*this, size);
+}
+
 void VulkanRenderer::render() {
     Renderer::render();
 
@@ -575,19 +815,38 @@ void VulkanRenderer::render() {
     BeginRenderPass();
 }
 
-void VulkanRenderer::wait_device_idle() const { vkDeviceWaitIdle(m_device); }
+void VulkanRenderer::wait_device_idle() const {
+    // Every queue of the device must be externally synchronised
+    std::scoped_lock lockQueue(m_queueLock);
+    vkDeviceWaitIdle(m_device);
+}
 
 RenderPipeline& VulkanRenderer::default_pipeline() { return *m_defaultPipeline; }
 
+RenderPipeline& VulkanRenderer::default_batch_pipeline() { return *m_defaultBatchPipeline; }
+
+RenderPipeline& VulkanRenderer::default_instanced_pipeline() {
+    return *m_defaultInstancedPipeline;
+}
+
+RenderPipeline& VulkanRenderer::default_sdf_pipeline() { return *m_defaultSDFPipeline; }
+
+RenderPipeline& VulkanRenderer::default_sdf_instanced_pipeline() {
+    return *m_defaultSDFInstancedPipeline;
+}
+
 void VulkanRenderer::resize_viewport(const Vector2i&) {
     // Recreate the swapchain
-    vkDeviceWaitIdle(m_device);
-    vkQueueWaitIdle(m_graphicsQueue);
+    wait_device_idle();
 
     EndRenderPass();
     EndFrame();
 
-    vkQueueWaitIdle(m_graphicsQueue);
+    wait_device_idle();
+
+    // Transient memory allocated so far belongs to the frame that was just ended,
+    // draws using it are only recorded once the next frame has begun
+    const unsigned previousFrame = m_currentFrame;
 
     for (VkFramebuffer fb : m_framebuffers) {
         vkDestroyFramebuffer(m_device, fb, nullptr);
@@ -723,7 +982,7 @@ void VulkanRenderer::resize_viewport(const Vector2i&) {
 
     {
         auto cmdBuf = CreateOneTimeCommandBuffer();
-        for (VulkanPipeline* pipeline : m_pipelines) {
+        m_pipelines.for_each([&](VulkanPipeline* pipeline) {
             // Bind our pipeline and set the viewport and scissor
             vkCmdBindPipeline(cmdBuf.Buffer(), VK_PIPELINE_BIND_POINT_GRAPHICS,
                               pipeline->GetPipelineHandle());
@@ -736,28 +995,42 @@ void VulkanRenderer::resize_viewport(const Vector2i&) {
                 16 * sizeof(float) /* 4x4 float matrix */, m_viewportTransform.matrix().matrix());
 
             // Our buffer will be submitted on destruction, so we don't need to do anything here
-        }
+        });
     }
 
     BeginFrame();
     BeginRenderPass();
+
+    // The device is idle, move the allocations to the frame that will read them
+    std::scoped_lock lockTransient(m_transientLock);
+    std::swap(m_frames[previousFrame].transientChain, m_frames[m_currentFrame].transientChain);
 }
 
 void VulkanRenderer::bind_texture(Texture::TextureHandle texture) {
-    m_boundTexture = reinterpret_cast<VulkanTexture*>(texture);
+    m_boundTexture = nullptr;
     if (texture) {
-        if (!m_textures.contains(m_boundTexture)) {
-            Logger::Warning("VulkanRenderer: Invalid texture handle {}, perhaps an invalid "
-                            "texture pointer was used.",
+        VulkanTexture* tex = m_textures.get(texture);
+        if (!tex) {
+            Logger::Warning("VulkanRenderer: Invalid texture handle {}, perhaps the texture "
+                            "was destroyed.",
                             texture);
-
-            m_boundTexture = nullptr;
             return;
         }
 
+        m_boundTexture = tex;
         VkDescriptorSet pDescriptorSets[] = {VK_NULL_HANDLE};
 
-        auto tex = reinterpret_cast<VulkanTexture*>(texture);
+        // Uploads wait for this frame before overwriting the texture,
+        // and this frame waits for the latest upload before sampling it
+        tex->m_lastUseFrame.store(m_frameValue + 1, std::memory_order_relaxed);
+        m_frameUploadWait =
+            std::max(m_frameUploadWait, tex->m_uploadValue.load(std::memory_order_relaxed));
+
+        if (m_boundPipeline && m_boundPipeline->Bindless()) {
+            // Already in the bindless texture table, prepare_pipeline pushes its slot
+            return;
+        }
+
         if (auto it = m_textureDescriptorSets.find(tex); it != m_textureDescriptorSets.end()) {
             pDescriptorSets[0] = it->second;
         } else {
@@ -773,7 +1046,7 @@ void VulkanRenderer::bind_texture(Texture::TextureHandle texture) {
                 .dstArrayElement = 0,
                 .descriptorCount = 1,
                 .descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
-                .pImageInfo = &reinterpret_cast<VulkanTexture*>(texture)->DescriptorImageInfo(),
+                .pImageInfo = &tex->DescriptorImageInfo(),
                 .pBufferInfo = nullptr,
                 .pTexelBufferView = nullptr,
             };
@@ -782,38 +1055,119 @@ void VulkanRenderer::bind_texture(Texture::TextureHandle texture) {
                                    nullptr); // Update sampler descriptor
         }
 
-        vkCmdBindDescriptorSets(m_commandBuffers[m_currentFrame], VK_PIPELINE_BIND_POINT_GRAPHICS,
-                                m_boundPipeline->PipelineLayout(), 0, 1, pDescriptorSets, 0,
-                                nullptr);
+        // The descriptor set is bound by prepare_draw if the texture has changed
     }
 }
 
 void VulkanRenderer::bind_pipeline(RenderPipeline::PipelineHandle pipeline) {
-    m_boundPipeline = reinterpret_cast<VulkanPipeline*>(pipeline);
+    m_boundPipeline = m_pipelines.get(pipeline);
 }
 
 void VulkanRenderer::bind_vertex_buffer(void* buffer) {
-    if (!m_vertexBuffers.contains((VertexBuffer*)buffer)) {
+    VertexBuffer* obj = m_vertexBuffers.get(buffer);
+    if (!obj) {
+        obj = m_transientBlocks.get(buffer);
+    }
+
+    if (!obj) {
         Logger::Warning("VulkanRenderer: Invalid vertex buffer handle {}.", buffer);
-        m_boundVertexBuffer = nullptr;
-        return;
     }
 
-    m_boundVertexBuffer = (VertexBuffer*)buffer;
+    m_boundVertexBuffer = obj;
 }
 
 void VulkanRenderer::do_draw_call(unsigned firstVertex, unsigned vertexCount,
                                   const Matrix4& transform, const Matrix4& view) {
-    if (!m_boundVertexBuffer) {
-        Logger::Debug("VulkanRenderer::do_draw_call: vertex buffer was not bound!");
+    if (!prepare_draw(transform, view)) {
+        return;
+    }
+
+    vkCmdDraw(m_commandBuffers[m_currentFrame], vertexCount, 1, firstVertex, 0);
+}
+
+void VulkanRenderer::do_draw_indexed_call(unsigned firstVertex, unsigned indexCount,
+                                          const Matrix4& transform, const Matrix4& view) {
+    if (!prepare_draw(transform, view)) {
         return;
     }
 
+    reserve_quad_indices(indexCount / 6);
+
+    vkCmdBindIndexBuffer(m_commandBuffers[m_currentFrame], m_quadIndexBuffer, 0,
+                         VK_INDEX_TYPE_UINT32);
+    vkCmdDrawIndexed(m_commandBuffers[m_currentFrame], indexCount, 1, 0,
+                     static_cast<int32_t>(firstVertex), 0);
+}
+
+void VulkanRenderer::upload_instances(const SpriteInstance* instances, unsigned count) {
+    std::scoped_lock lockTransient(m_transientLock);
+    TransientAllocation allocation =
+        m_frames[m_currentFrame].transientChain.allocate(*this, count * sizeof(SpriteInstance));
+
+    memcpy(allocation.data, instances, count * sizeof(SpriteInstance));
+    m_instanceBuffer = m_transientBlocks.get(allocation.vertexBuffer)->buffer;
+    m_instanceOffset = allocation.offset;
+}
+
+void VulkanRenderer::do_draw_instanced_call(unsigned firstInstance, unsigned instanceCount,
+                                            const Matrix4& view) {
+    if (!prepare_pipeline(view, true)) {
+        return;
+    }
+
+    const VkBuffer pBuffers[2] = {m_unitQuadBuffer, m_instanceBuffer};
+    const VkDeviceSize offsets[2] = {0, m_instanceOffset};
+    vkCmdBindVertexBuffers(m_commandBuffers[m_currentFrame], 0, 2, pBuffers, offsets);
+    // Binding 0 no longer holds a VertexBuffer
+    m_lastVertexBuffers[m_currentFrame] = nullptr;
+
+    vkCmdDraw(m_commandBuffers[m_currentFrame], 4, instanceCount, 0, firstInstance);
+}
+
+bool VulkanRenderer::prepare_draw(const Matrix4& transform, const Matrix4& view) {
+    if (!m_boundVertexBuffer) {
+        Logger::Debug("VulkanRenderer::prepare_draw: vertex buffer was not bound!");
+        return false;
+    }
+
+    if (!prepare_pipeline(view)) {
+        return false;
+    }
+
+    if (m_boundVertexBuffer != m_lastVertexBuffers[m_currentFrame]) {
+        m_lastVertexBuffers[m_currentFrame] = m_boundVertexBuffer;
+
+        VkDeviceSize offsets[] = {0};
+        if (m_boundVertexBuffer->buffer) {
+            vkCmdBindVertexBuffers(m_commandBuffers[m_currentFrame], 0, 1,
+                                   &m_boundVertexBuffer->buffer, offsets);
+        } else {
+            const VkBuffer pBuffers[1] = {VK_NULL_HANDLE};
+            vkCmdBindVertexBuffers(m_commandBuffers[m_currentFrame], 0, 1, pBuffers, offsets);
+        }
+    }
+
+    m_boundPipeline->UpdatePushConstant(
+        m_commandBuffers[m_currentFrame],
+        offsetof(VulkanPipeline::PushConstant2DTransform, transform),
+        16 * sizeof(float) /* 4x4 float matrix */, transform.matrix());
+
+    return true;
+}
+
+bool VulkanRenderer::prepare_pipeline(const Matrix4& view, bool instanced) {
+    if (!m_boundPipeline) {
+        Logger::Debug("VulkanRenderer::prepare_pipeline: pipeline was not bound!");
+        return false;
+    }
+
     // Only rebind the pipeline and descriptor sets
     // and update the viewport transform
     // when the pipeline has changed.
     if (m_boundPipeline != m_lastPipelines[m_currentFrame]) {
         m_lastPipelines[m_currentFrame] = m_boundPipeline;
+        // Rebind the texture in case the pipeline layout differs
+        m_lastTextures[m_currentFrame] = nullptr;
 
         vkCmdBindPipeline(m_commandBuffers[m_currentFrame], VK_PIPELINE_BIND_POINT_GRAPHICS,
                           m_boundPipeline->GetPipelineHandle());
@@ -825,38 +1179,47 @@ void VulkanRenderer::do_draw_call(unsigned firstVertex, unsigned vertexCount,
             m_commandBuffers[m_currentFrame],
             offsetof(VulkanPipeline::PushConstant2DTransform, viewport),
             16 * sizeof(float) /* 4x4 float matrix */, m_viewportTransform.matrix().matrix());
+
+        if (m_boundPipeline->Bindless()) {
+            // Holds every texture, so it is only bound with the pipeline
+            vkCmdBindDescriptorSets(m_commandBuffers[m_currentFrame],
+                                    VK_PIPELINE_BIND_POINT_GRAPHICS,
+                                    m_boundPipeline->PipelineLayout(), 0, 1, &m_bindlessSet, 0,
+                                    nullptr);
+        }
     }
 
     m_boundPipeline->UpdatePushConstant(m_commandBuffers[m_currentFrame],
                                         offsetof(VulkanPipeline::PushConstant2DTransform, canvas),
                                         16 * sizeof(float) /* 4x4 float matrix */, view.matrix());
 
-    if (m_boundTexture /*&& m_boundTexture != m_lastTextures[m_currentFrame]*/) {
+    if (m_boundPipeline->Bindless()) {
+        // Without a texture instanced draws sample the texture of each instance,
+        // other draws sample white
+        uint32_t textureIndex = m_whiteTexture->m_bindlessIndex;
+        if (m_boundTexture) {
+            textureIndex = m_boundTexture->m_bindlessIndex;
+        } else if (instanced) {
+            textureIndex = VulkanPipeline::InstanceTextureIndex;
+            m_frameSamplesInstanceTextures = true;
+        }
+
+        m_boundPipeline->UpdatePushConstant(
+            m_commandBuffers[m_currentFrame],
+            offsetof(VulkanPipeline::PushConstant2DTransform, textureIndex), sizeof(uint32_t),
+            &textureIndex);
+    } else if (!m_boundTexture) {
+        Logger::Debug("tex not bound!");
+    } else if (m_boundTexture != m_lastTextures[m_currentFrame]) {
         VkDescriptorSet pDescriptorSets[] = {m_textureDescriptorSets.at(m_boundTexture)};
         vkCmdBindDescriptorSets(m_commandBuffers[m_currentFrame], VK_PIPELINE_BIND_POINT_GRAPHICS,
                                 m_boundPipeline->PipelineLayout(), 0, 1, pDescriptorSets, 0,
                                 nullptr);
 
         m_lastTextures[m_currentFrame] = m_boundTexture;
-    } else {
-        Logger::Debug("tex not bound!");
     }
 
-    VkDeviceSize offsets[] = {0};
-    if (m_boundVertexBuffer && m_boundVertexBuffer->buffer) {
-        vkCmdBindVertexBuffers(m_commandBuffers[m_currentFrame], 0, 1, &m_boundVertexBuffer->buffer,
-                               offsets);
-    } else {
-        const VkBuffer pBuffers[1] = {VK_NULL_HANDLE};
-        vkCmdBindVertexBuffers(m_commandBuffers[m_currentFrame], 0, 1, pBuffers, offsets);
-    }
-
-    m_boundPipeline->UpdatePushConstant(
-        m_commandBuffers[m_currentFrame],
-        offsetof(VulkanPipeline::PushConstant2DTransform, transform),
-        16 * sizeof(float) /* 4x4 float matrix */, transform.matrix());
-
-    vkCmdDraw(m_commandBuffers[m_currentFrame], vertexCount, 1, firstVertex, 0);
+    return true;
 }
 
 VulkanRenderer::OneTimeCommandBuffer::OneTimeCommandBuffer(VulkanRenderer& renderer,
@@ -910,8 +1273,11 @@ VulkanRenderer::OneTimeCommandBuffer::~OneTimeCommandBuffer() {
     VkFence fence;
     vkCheck(vkCreateFence(m_renderer.m_device, &fenceInfo, nullptr, &fence)); // Create a fence
 
-    vkCheck(
-        vkQueueSubmit(m_renderer.m_graphicsQueue, 1, &submitInfo, fence)); // Submit to the queue
+    {
+        std::scoped_lock lockQueue(m_renderer.m_queueLock);
+        vkCheck(vkQueueSubmit(m_renderer.m_graphicsQueue, 1, &submitInfo,
+                              fence)); // Submit to the queue
+    }
 
     vkWaitForFences(m_renderer.m_device, 1, &fence, VK_TRUE,
                     UINT64_MAX); // Make sure we are finished
@@ -933,37 +1299,75 @@ void VulkanRenderer::BeginFrame() {
     vkCheck(vkResetCommandPool(m_device, m_commandPools[m_currentFrame],
                                0)); // Apparently resetting the whole command pool is faster
 
-    std::scoped_lock lockBufferDestruction(m_bufferDestroyLock);
-    for (auto& buffer : m_buffersPendingDestruction) {
-        vmaDestroyBuffer(m_alloc, buffer.first, buffer.second);
+    // The GPU is done with everything this frame used the last time it was recorded
+    {
+        std::scoped_lock lockBufferDestruction(m_bufferDestroyLock);
+        for (auto& buffer : m_buffersPendingDestruction[m_currentFrame]) {
+            vmaDestroyBuffer(m_alloc, buffer.first, buffer.second);
+        }
+        m_buffersPendingDestruction[m_currentFrame].clear();
+    }
+
+    {
+        std::scoped_lock lockTransient(m_transientLock);
+        frame.transientChain.reset(*this);
     }
-    m_buffersPendingDestruction.clear();
 
     BeginCommandBuffer();
 
     m_lastTextures[m_currentFrame] = nullptr;
     m_lastPipelines[m_currentFrame] = 0;
+    m_lastVertexBuffers[m_currentFrame] = nullptr;
 }
 
 void VulkanRenderer::EndFrame() {
     EndCommandBuffer();
 
-    VkPipelineStageFlags waitStages[] = {VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT};
+    // Uploads recorded since the last frame, the frame may wait on them
+    m_uploader->flush();
+
+    if (m_frameSamplesInstanceTextures) {
+        // Instances may sample any texture, wait for every upload
+        // and make later uploads wait for this frame
+        m_frameUploadWait = std::max(m_frameUploadWait, m_uploader->submitted_value());
+        m_instanceTextureFrame.store(m_frameValue + 1, std::memory_order_relaxed);
+        m_frameSamplesInstanceTextures = false;
+    }
+
     Frame& frame = m_frames[m_currentFrame];
 
+    const VkSemaphore waitSemaphores[] = {frame.imageAvailableSemaphore, m_uploader->timeline()};
+    const VkPipelineStageFlags waitStages[] = {VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT,
+                                               VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT};
+    const VkSemaphore signalSemaphores[] = {frame.renderFinishedSemaphore, m_frameTimeline};
+
+    // Values of binary semaphores are ignored
+    const uint64_t waitValues[] = {0, m_frameUploadWait};
+    const uint64_t signalValues[] = {0, ++m_frameValue};
+    VkTimelineSemaphoreSubmitInfo timelineInfo = {
+        .sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO,
+        .pNext = nullptr,
+        .waitSemaphoreValueCount = 2,
+        .pWaitSemaphoreValues = waitValues,
+        .signalSemaphoreValueCount = 2,
+        .pSignalSemaphoreValues = signalValues,
+    };
+
     VkSubmitInfo submitInfo = {
         .sType = VK_STRUCTURE_TYPE_SUBMIT_INFO,
-        .pNext = nullptr,
-        .waitSemaphoreCount = 1,
-        .pWaitSemaphores = &frame.imageAvailableSemaphore,
+        .pNext = &timelineInfo,
+        .waitSemaphoreCount = 2,
+        .pWaitSemaphores = waitSemaphores,
         .pWaitDstStageMask = waitStages,
         .commandBufferCount = 1,
         .pCommandBuffers = &m_commandBuffers[m_currentFrame],
-        .signalSemaphoreCount = 1,
-        .pSignalSemaphores = &frame.renderFinishedSemaphore,
+        .signalSemaphoreCount = 2,
+        .pSignalSemaphores = signalSemaphores,
     };
 
+    std::scoped_lock lockQueue(m_queueLock);
     vkCheck(vkQueueSubmit(m_graphicsQueue, 1, &submitInfo, frame.fence));
+    m_frameUploadWait = 0;
 
     VkPresentInfoKHR presentInfo = {
         .sType = VK_STRUCTURE_TYPE_PRESENT_INFO_KHR,
@@ -1077,6 +1481,23 @@ int VulkanRenderer::GPUSuitability(VkPhysicalDevice dev) {
     VkPhysicalDeviceProperties properties;
     vkGetPhysicalDeviceProperties(dev, &properties);
 
+    // Texture uploads are tracked with timeline semaphores
+    if (properties.apiVersion < VK_API_VERSION_1_2) {
+        return 0;
+    }
+
+    VkPhysicalDeviceVulkan12Features features12 = {};
+    features12.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES;
+
+    VkPhysicalDeviceFeatures2 features2 = {};
+    features2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+    features2.pNext = &features12;
+
+    vkGetPhysicalDeviceFeatures2(dev, &features2);
+    if (!features12.timelineSemaphore) {
+        return 0;
+    }
+
     if (properties.deviceType == VK_PHYSICAL_DEVICE_TYPE_DISCRETE_GPU) {
         score += 1000;
     } else if (properties.deviceType == VK_PHYSICAL_DEVICE_TYPE_INTEGRATED_GPU) {
@@ -1102,6 +1523,24 @@ std::optional<uint32_t> VulkanRenderer::GetGraphicsQueueFamily() {
     return std::optional<uint32_t>();
 }
 
+std::optional<uint32_t> VulkanRenderer::GetTransferQueueFamily() {
+    uint32_t queueFamilyCount;
+    vkGetPhysicalDeviceQueueFamilyProperties(m_renderGPU, &queueFamilyCount, nullptr);
+
+    std::vector<VkQueueFamilyProperties> queueFamilies(queueFamilyCount);
+    vkGetPhysicalDeviceQueueFamilyProperties(m_renderGPU, &queueFamilyCount, queueFamilies.data());
+
+    for (uint32_t i = 0; i < queueFamilies.size(); i++) {
+        // Usually backed by a DMA engine which copies alongside rendering
+        if ((queueFamilies[i].queueFlags & VK_QUEUE_TRANSFER_BIT) &&
+            !(queueFamilies[i].queueFlags & (VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT))) {
+            return std::optional<uint32_t>(i);
+        }
+    }
+
+    return std::optional<uint32_t>();
+}
+
 VulkanRenderer::SwapChainInfo VulkanRenderer::GetSwapChainInfo() {
     assert(m_renderGPU != VK_NULL_HANDLE);
 
@@ -1146,27 +1585,49 @@ int VulkanRenderer::CreateLogicalDevice() {
     float queuePriority = 1.f; // Highest priority is 1, lowest is 0
     m_graphicsQueueFamily = gQueueFamily.value();
 
-    VkDeviceQueueCreateInfo queueCreateInfo = {
-        .sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO,
-        .pNext = nullptr,
-        .flags = 0,
-        .queueFamilyIndex = gQueueFamily.value(),
-        .queueCount = 1,
-        .pQueuePriorities = &queuePriority,
+    // Without a transfer queue uploads are submitted to the graphics queue
+    m_transferQueueFamily = GetTransferQueueFamily().value_or(m_graphicsQueueFamily);
+    const bool hasTransferQueue = m_transferQueueFamily != m_graphicsQueueFamily;
+
+    VkDeviceQueueCreateInfo queueCreateInfos[2] = {
+        {
+            .sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO,
+            .pNext = nullptr,
+            .flags = 0,
+            .queueFamilyIndex = gQueueFamily.value(),
+            .queueCount = 1,
+            .pQueuePriorities = &queuePriority,
+        },
+        {
+            .sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO,
+            .pNext = nullptr,
+            .flags = 0,
+            .queueFamilyIndex = m_transferQueueFamily,
+            .queueCount = 1,
+            .pQueuePriorities = &queuePriority,
+        },
     };
 
     VkPhysicalDeviceFeatures usedDeviceFeatures = {};
 
+    // Texture uploads are tracked with timeline semaphores
+    VkPhysicalDeviceVulkan12Features usedVulkan12Features = {};
+    usedVulkan12Features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES;
+    usedVulkan12Features.timelineSemaphore = VK_TRUE;
+
+    // Without descriptor indexing every texture has a descriptor set of its own
+    m_bindlessTextures = QueryBindlessTextures(usedVulkan12Features);
+
     const char* const enabledExtensions[] = {
         VK_KHR_SWAPCHAIN_EXTENSION_NAME,
     }; // Currently we only enable swapchain extension
 
     VkDeviceCreateInfo createInfo = {
         .sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO,
-        .pNext = nullptr,
+        .pNext = &usedVulkan12Features,
         .flags = 0,
-        .queueCreateInfoCount = 1,
-        .pQueueCreateInfos = &queueCreateInfo,
+        .queueCreateInfoCount = hasTransferQueue ? 2u : 1u,
+        .pQueueCreateInfos = queueCreateInfos,
         .enabledLayerCount = 0,
         .ppEnabledLayerNames = nullptr,
         .enabledExtensionCount = 1,
@@ -1180,10 +1641,194 @@ int VulkanRenderer::CreateLogicalDevice() {
     }
 
     vkGetDeviceQueue(m_device, gQueueFamily.value(), 0, &m_graphicsQueue);
+    if (hasTransferQueue) {
+        vkGetDeviceQueue(m_device, m_transferQueueFamily, 0, &m_transferQueue);
+    } else {
+        m_transferQueue = m_graphicsQueue;
+    }
+
+    Logger::Debug("VulkanRenderer: Uploading textures on a dedicated transfer queue? {}",
+                  hasTransferQueue ? "Yes" : "No");
+    Logger::Debug("VulkanRenderer: Using bindless textures? {} ({} slots)",
+                  m_bindlessTextures ? "Yes" : "No", m_bindlessCapacity);
 
     return 0;
 }
 
+bool VulkanRenderer::QueryBindlessTextures(VkPhysicalDeviceVulkan12Features& usedFeatures) {
+#ifndef RENDERING_VULKANRENDERER_ENABLE_BINDLESS_TEXTURES
+    return false;
+#else
+    VkPhysicalDeviceVulkan12Features features12 = {};
+    features12.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES;
+
+    VkPhysicalDeviceFeatures2 features2 = {};
+    features2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+    features2.pNext = &features12;
+
+    vkGetPhysicalDeviceFeatures2(m_renderGPU, &features2);
+
+    // Slots are written while frames using other slots are in flight and may stay empty
+    if (!features12.runtimeDescriptorArray ||
+        !features12.shaderSampledImageArrayNonUniformIndexing ||
+        !features12.descriptorBindingPartiallyBound ||
+        !features12.descriptorBindingSampledImageUpdateAfterBind ||
+        !features12.descriptorBindingUpdateUnusedWhilePending) {
+        return false;
+    }
+
+    VkPhysicalDeviceVulkan12Properties properties12 = {};
+    properties12.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_PROPERTIES;
+
+    VkPhysicalDeviceProperties2 properties2 = {};
+    properties2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2;
+    properties2.pNext = &properties12;
+
+    vkGetPhysicalDeviceProperties2(m_renderGPU, &properties2);
+
+    // Combined image samplers count as both a sampled image and a sampler
+    m_bindlessCapacity = std::min({
+        uint32_t{RENDERING_VULKANRENDERER_BINDLESS_TEXTURE_COUNT},
+        properties12.maxPerStageDescriptorUpdateAfterBindSampledImages,
+        properties12.maxPerStageDescriptorUpdateAfterBindSamplers,
+        properties12.maxDescriptorSetUpdateAfterBindSampledImages,
+        properties12.maxDescriptorSetUpdateAfterBindSamplers,
+        properties12.maxPerStageUpdateAfterBindResources,
+    });
+
+    usedFeatures.runtimeDescriptorArray = VK_TRUE;
+    usedFeatures.shaderSampledImageArrayNonUniformIndexing = VK_TRUE;
+    usedFeatures.descriptorBindingPartiallyBound = VK_TRUE;
+    usedFeatures.descriptorBindingSampledImageUpdateAfterBind = VK_TRUE;
+    usedFeatures.descriptorBindingUpdateUnusedWhilePending = VK_TRUE;
+    return true;
+#endif
+}
+
+void VulkanRenderer::LoadPipelineCache() {
+    const PipelineCacheFileHeader expected = pipeline_cache_header(m_renderGPU);
+
+    std::vector<uint8_t> data;
+
+    // Each game has its own cache so games do not overwrite each other's pipelines
+    std::string cacheDirectory = Platform::user_cache_directory();
+    if (!cacheDirectory.empty()) {
+        m_pipelineCachePath = cacheDirectory + Platform::application_name() +
+                              RENDERING_VULKANRENDERER_PIPELINE_CACHE_SUFFIX;
+    }
+
+    // There is no cache on the first launch, which is not worth an error
+    File* file = nullptr;
+    if (!m_pipelineCachePath.empty() && File::Exists(m_pipelineCachePath.c_str()) &&
+        (file = File::Open(m_pipelineCachePath.c_str()))) {
+        PipelineCacheFileHeader header;
+        const ssize_t fileSize = file->get_size();
+
+        bool valid = fileSize >= static_cast<ssize_t>(sizeof(header)) &&
+                     file->Read(&header, sizeof(header)) == static_cast<ssize_t>(sizeof(header));
+
+        // Caches from another device or driver version are of no use,
+        // a truncated write leaves the data size disagreeing with the file size
+        valid = valid && header.magic == expected.magic && header.version == expected.version &&
+                header.vendorID == expected.vendorID && header.deviceID == expected.deviceID &&
+                header.driverVersion == expected.driverVersion &&
+                !memcmp(header.deviceUUID, expected.deviceUUID, VK_UUID_SIZE) &&
+                header.dataSize == fileSize - sizeof(header);
+
+        if (valid) {
+            data.resize(header.dataSize);
+            valid = file->Read(data.data(), data.size()) == static_cast<ssize_t>(data.size());
+        }
+
+        // The driver checks its own header too, but the pipeline cache UUID also changes
+        // with driver builds which keep the same version
+        if (valid) {
+            VkPhysicalDeviceProperties p;
+            vkGetPhysicalDeviceProperties(m_renderGPU, &p);
+
+            VkPipelineCacheHeaderVersionOne driverHeader;
+            valid = data.size() >= sizeof(driverHeader);
+            if (valid) {
+                memcpy(&driverHeader, data.data(), sizeof(driverHeader));
+                valid = driverHeader.headerVersion == VK_PIPELINE_CACHE_HEADER_VERSION_ONE &&
+                        !memcmp(driverHeader.pipelineCacheUUID, p.pipelineCacheUUID,
+                                VK_UUID_SIZE);
+            }
+        }
+
+        if (!valid) {
+            Logger::Debug("VulkanRenderer: Discarding stale pipeline cache '{}'",
+                          m_pipelineCachePath);
+            data.clear();
+        }
+
+        delete file;
+    }
+
+    VkPipelineCacheCreateInfo cacheCreateInfo = {
+        .sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO,
+        .pNext = nullptr,
+        .flags = 0,
+        .initialDataSize = data.size(),
+        .pInitialData = data.data(),
+    };
+
+    if (data.size() && vkCreatePipelineCache(m_device, &cacheCreateInfo, nullptr,
+                                             &m_pipelineCache) != VK_SUCCESS) {
+        Logger::Warning("VulkanRenderer: Driver rejected pipeline cache '{}'", m_pipelineCachePath);
+        data.clear();
+    }
+
+    if (!data.size()) {
+        cacheCreateInfo.initialDataSize = 0;
+        cacheCreateInfo.pInitialData = nullptr;
+        vkCheck(vkCreatePipelineCache(m_device, &cacheCreateInfo, nullptr, &m_pipelineCache));
+    }
+
+    Logger::Debug("VulkanRenderer: Using pipeline cache from disk? {} ({} bytes)",
+                  data.size() ? "Yes" : "No", data.size());
+}
+
+void VulkanRenderer::SavePipelineCache() {
+    if (m_pipelineCache == VK_NULL_HANDLE || m_pipelineCachePath.empty()) {
+        return;
+    }
+
+    PipelineCacheFileHeader header = pipeline_cache_header(m_renderGPU);
+
+    size_t dataSize = 0;
+    if (vkGetPipelineCacheData(m_device, m_pipelineCache, &dataSize, nullptr) != VK_SUCCESS) {
+        Logger::Warning("VulkanRenderer: Failed to get pipeline cache data!");
+        return;
+    }
+
+    std::vector<uint8_t> contents(sizeof(header) + dataSize);
+    if (vkGetPipelineCacheData(m_device, m_pipelineCache, &dataSize,
+                               contents.data() + sizeof(header)) != VK_SUCCESS) {
+        Logger::Warning("VulkanRenderer: Failed to get pipeline cache data!");
+        return;
+    }
+
+    header.dataSize = dataSize;
+    memcpy(contents.data(), &header, sizeof(header));
+
+    File* file = File::Open(m_pipelineCachePath.c_str(), File::OpenWrite);
+    if (!file) {
+        Logger::Warning("VulkanRenderer: Failed to open pipeline cache '{}' for writing",
+                        m_pipelineCachePath);
+        return;
+    }
+
+    if (file->Write(contents.data(), contents.size()) != static_cast<ssize_t>(contents.size())) {
+        Logger::Warning("VulkanRenderer: Failed to write pipeline cache '{}'", m_pipelineCachePath);
+    } else {
+        Logger::Debug("VulkanRenderer: Wrote pipeline cache '{}' ({} bytes)", m_pipelineCachePath,
+                      dataSize);
+    }
+
+    delete file;
+}
+
 void VulkanRenderer::CreateCommandPools() {
     VkCommandPoolCreateInfo poolInfo = {
         .sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO,
@@ -1305,6 +1950,100 @@ void VulkanRenderer::free_descriptor_set(DescriptorPool* pool, VkDescriptorSet s
     pool->freeSets.push(set);
 }
 
+void VulkanRenderer::create_bindless_texture_table() {
+    VkDescriptorSetLayoutBinding binding = {
+        .binding = RENDERING_VULKANRENDERER_TEXTURE_SAMPLER_DESCRIPTOR,
+        .descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
+        .descriptorCount = m_bindlessCapacity,
+        .stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT,
+        .pImmutableSamplers = nullptr,
+    };
+
+    // Slots are written while command buffers using the set are recorded or in flight,
+    // and slots without a texture are never sampled
+    const VkDescriptorBindingFlags bindingFlags =
+        VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT | VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT |
+        VK_DESCRIPTOR_BINDING_UPDATE_UNUSED_WHILE_PENDING_BIT;
+
+    VkDescriptorSetLayoutBindingFlagsCreateInfo bindingFlagsCreateInfo = {
+        .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO,
+        .pNext = nullptr,
+        .bindingCount = 1,
+        .pBindingFlags = &bindingFlags,
+    };
+
+    VkDescriptorSetLayoutCreateInfo layoutCreateInfo = {
+        .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO,
+        .pNext = &bindingFlagsCreateInfo,
+        .flags = VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT,
+        .bindingCount = 1,
+        .pBindings = &binding,
+    };
+
+    vkCheck(vkCreateDescriptorSetLayout(m_device, &layoutCreateInfo, nullptr,
+                                        &m_bindlessSetLayout));
+
+    VkDescriptorPoolSize poolSize = {
+        .type = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
+        .descriptorCount = m_bindlessCapacity,
+    };
+
+    VkDescriptorPoolCreateInfo poolCreateInfo = {
+        .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO,
+        .pNext = nullptr,
+        .flags = VK_DESCRIPTOR_POOL_CREATE_UPDATE_AFTER_BIND_BIT,
+        .maxSets = 1,
+        .poolSizeCount = 1,
+        .pPoolSizes = &poolSize,
+    };
+
+    vkCheck(vkCreateDescriptorPool(m_device, &poolCreateInfo, nullptr, &m_bindlessPool));
+
+    VkDescriptorSetAllocateInfo setAllocInfo = {
+        .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO,
+        .pNext = nullptr,
+        .descriptorPool = m_bindlessPool,
+        .descriptorSetCount = 1,
+        .pSetLayouts = &m_bindlessSetLayout,
+    };
+
+    vkCheck(vkAllocateDescriptorSets(m_device, &setAllocInfo, &m_bindlessSet));
+}
+
+void VulkanRenderer::add_bindless_texture(VulkanTexture* texture) {
+    uint32_t slot;
+    if (!m_freeBindlessSlots.empty()) {
+        slot = m_freeBindlessSlots.back();
+        m_freeBindlessSlots.pop_back();
+    } else if (m_nextBindlessSlot < m_bindlessCapacity) {
+        slot = m_nextBindlessSlot++;
+    } else {
+        // Keeps slot 0, the texture is drawn white
+        Logger::Error("VulkanRenderer::add_bindless_texture: Ran out of bindless texture slots "
+                      "({})!",
+                      m_bindlessCapacity);
+        return;
+    }
+
+    texture->m_bindlessIndex = slot;
+    texture->m_hasBindlessSlot = true;
+
+    VkWriteDescriptorSet descriptorWrite = {
+        .sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
+        .pNext = nullptr,
+        .dstSet = m_bindlessSet,
+        .dstBinding = RENDERING_VULKANRENDERER_TEXTURE_SAMPLER_DESCRIPTOR,
+        .dstArrayElement = slot,
+        .descriptorCount = 1,
+        .descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
+        .pImageInfo = &texture->DescriptorImageInfo(),
+        .pBufferInfo = nullptr,
+        .pTexelBufferView = nullptr,
+    };
+
+    vkUpdateDescriptorSets(m_device, 1, &descriptorWrite, 0, nullptr);
+}
+
 void VulkanRenderer::BeginCommandBuffer() {
     VkCommandBufferBeginInfo beginInfo = {
         .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
@@ -1467,9 +2206,110 @@ void VulkanRenderer::_create_vertex_buffer(VertexBuffer* obj, uint32_t vertexCou
     };
 }
 
+void VulkanRenderer::reserve_quad_indices(uint32_t quadCount) {
+    if (quadCount <= m_quadIndexCapacity) {
+        return;
+    }
+
+    // Grow geometrically so growing scenes do not recreate the buffer every frame
+    uint32_t capacity = std::max(quadCount, m_quadIndexCapacity * 2);
+
+    VkBuffer buffer;
+    VmaAllocation allocation;
+    uint32_t* indices = reinterpret_cast<uint32_t*>(create_mapped_buffer(
+        capacity * 6 * sizeof(uint32_t), VK_BUFFER_USAGE_INDEX_BUFFER_BIT, buffer, allocation));
+    for (uint32_t i = 0; i < capacity; i++) {
+        uint32_t v = i * 4;
+        uint32_t* quad = &indices[i * 6];
+
+        quad[0] = v;
+        quad[1] = v + 1;
+        quad[2] = v + 2;
+        quad[3] = v + 2;
+        quad[4] = v + 1;
+        quad[5] = v + 3;
+    }
+
+    // Earlier draws this frame may still reference the old buffer
+    if (m_quadIndexBuffer) {
+        std::scoped_lock lockBufferDestruction(m_bufferDestroyLock);
+        m_buffersPendingDestruction[m_currentFrame].push_back(
+            {m_quadIndexBuffer, m_quadIndexAllocation});
+    }
+
+    m_quadIndexBuffer = buffer;
+    m_quadIndexAllocation = allocation;
+    m_quadIndexCapacity = capacity;
+}
+
+void* VulkanRenderer::create_mapped_buffer(VkDeviceSize size, VkBufferUsageFlags usage,
+                                           VkBuffer& buffer, VmaAllocation& allocation) {
+    VkBufferCreateInfo bufferInfo = {
+        .sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
+        .pNext = nullptr,
+        .flags = 0,
+        .size = size,
+        .usage = usage,
+        .sharingMode = VK_SHARING_MODE_EXCLUSIVE,
+        .queueFamilyIndexCount = 0,
+        .pQueueFamilyIndices = nullptr,
+    };
+
+    VmaAllocationCreateInfo allocCreateInfo = {
+        .flags = VMA_ALLOCATION_CREATE_MAPPED_BIT,
+        .usage = VMA_MEMORY_USAGE_CPU_TO_GPU,
+        .requiredFlags = 0,
+        .preferredFlags = 0,
+        .memoryTypeBits = 0,
+        .pool = 0,
+        .pUserData = nullptr,
+        .priority = 0.0f,
+    };
+
+    VmaAllocationInfo allocInfo = {};
+    vkCheck(
+        vmaCreateBuffer(m_alloc, &bufferInfo, &allocCreateInfo, &buffer, &allocation, &allocInfo));
+
+    return allocInfo.pMappedData;
+}
+
+Renderer::TransientBlock VulkanRenderer::create_transient_block(size_t size) {
+    // Sized in whole vertices like any other vertex buffer
+    const uint32_t vertexCount =
+        static_cast<uint32_t>((size + sizeof(Vertex) - 1) / sizeof(Vertex));
+
+    VertexBuffer* block = new VertexBuffer;
+    block->size = vertexCount;
+    block->hostMapping = create_mapped_buffer(
+        vertexCount * sizeof(Vertex),
+        VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT, block->buffer,
+        block->allocation);
+
+    block->handle = m_transientBlocks.insert(block);
+    return {static_cast<uint8_t*>(block->hostMapping), vertexCount * sizeof(Vertex), 0,
+            block->handle, block};
+}
+
+void VulkanRenderer::destroy_transient_block(const TransientBlock& transientBlock) {
+    VertexBuffer* block = static_cast<VertexBuffer*>(transientBlock.backend);
+    if (m_boundVertexBuffer == block) {
+        m_boundVertexBuffer = nullptr;
+    }
+
+    for (unsigned i = 0; i < RENDERING_VULKANRENDERER_MAX_FRAMES_IN_FLIGHT; i++) {
+        if (m_lastVertexBuffers[i] == block) {
+            m_lastVertexBuffers[i] = nullptr;
+        }
+    }
+
+    m_transientBlocks.erase(block->handle);
+    vmaDestroyBuffer(m_alloc, block->buffer, block->allocation);
+    delete block;
+}
+
 void VulkanRenderer::_destroy_vertex_buffer(VertexBuffer* obj) {
     std::scoped_lock lockBufferDestruction(m_bufferDestroyLock);
-    m_buffersPendingDestruction.push_back({obj->buffer, obj->allocation});
+    m_buffersPendingDestruction[m_currentFrame].push_back({obj->buffer, obj->allocation});
 }
 
 } // namespace Arclight::Rendering
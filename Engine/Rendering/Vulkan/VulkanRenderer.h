@@ -2,6 +2,7 @@
 
 #include <vulkan/vulkan.h>
 
+#include <Arclight/Graphics/Rendering/HandleTable.h>
 #include <Arclight/Graphics/Rendering/Renderer.h>
 #include <Arclight/Graphics/Texture.h>
 #include <Arclight/Graphics/Transform.h>
@@ -13,18 +14,34 @@
 #include "VulkanMemory.h"
 #include "VulkanPipeline.h"
 #include "VulkanTexture.h"
+#include "VulkanUploader.h"
 
+#include <atomic>
 #include <cassert>
+#include <memory>
+#include <mutex>
 #include <optional>
-#include <set>
+#include <string>
 #include <unordered_map>
 #include <vector>
 
 #define RENDERING_VULKANRENDERER_MAX_FRAMES_IN_FLIGHT 2
 #define RENDERING_VULKANRENDERER_UBO_DESCRIPTOR 0
 #define RENDERING_VULKANRENDERER_TEXTURE_SAMPLER_DESCRIPTOR 1
+// Initial size of the transient ring of each frame in flight in bytes,
+// grows to fit the largest frame
+#define RENDERING_VULKANRENDERER_TRANSIENT_RING_SIZE (1024 * 1024)
+// Slots in the bindless texture table, lowered to the limits of the GPU
+#define RENDERING_VULKANRENDERER_BINDLESS_TEXTURE_COUNT 16384
+// Appended to the application name for the pipeline cache file in the user cache directory,
+// kept between launches
+#define RENDERING_VULKANRENDERER_PIPELINE_CACHE_SUFFIX "_vulkan_pipeline_cache.bin"
+// Bump on any change to the header of the pipeline cache file
+#define RENDERING_VULKANRENDERER_PIPELINE_CACHE_VERSION 1
 
 #define RENDERING_VULKANRENDERER_ENABLE_VALIDATION_LAYERS
+// Use the bindless texture table where the GPU supports descriptor indexing
+#define RENDERING_VULKANRENDERER_ENABLE_BINDLESS_TEXTURES
 
 namespace Arclight::Rendering {
 
@@ -44,6 +61,10 @@ public:
 
     // Get the default RenderPipeline
     RenderPipeline& default_pipeline();
+    RenderPipeline& default_batch_pipeline() override;
+    RenderPipeline& default_instanced_pipeline() override;
+    RenderPipeline& default_sdf_pipeline() override;
+    RenderPipeline& default_sdf_instanced_pipeline() override;
 
     void bind_pipeline(RenderPipeline::PipelineHandle pipeline) override;
     void bind_texture(Texture::TextureHandle texture) override;
@@ -58,17 +79,26 @@ public:
     create_pipeline(const Shader& vertexShader, const Shader& fragmentShader,
                     const RenderPipeline::PipelineFixedConfig& config) override;
     void destroy_pipeline(RenderPipeline::PipelineHandle handle) override;
+    bool pipeline_valid(RenderPipeline::PipelineHandle handle) const override {
+        return m_pipelines.contains(handle);
+    }
 
     Texture::TextureHandle allocate_texture(const Vector2u& bounds,
                                             Texture::Format format) override;
     void update_texture(Texture::TextureHandle texture, const void* data) override;
     void destroy_texture(Texture::TextureHandle texture) override;
 
+    bool has_bindless_textures() const override { return m_bindlessTextures; }
+    // Index 0 is a white texture, for instances without a texture
+    uint32_t bindless_texture_index(Texture::TextureHandle texture) const override;
+
     void* allocate_vertex_buffer(unsigned vertexCount) override;
     void update_vertex_buffer(void* buffer, unsigned int offset, unsigned int size, const Vertex* data) override;
     void* get_vertex_buffer_mapping(void* buffer) override;
     void destroy_vertex_buffer(void* buffer) override;
 
+    TransientAllocation allocate_transient(size_t size) override;
+
     constexpr VkFormat TextureToVkFormat(Texture::Format format) {
         switch (format) {
         case Texture::Format_RGBA8_SRGB:
@@ -76,7 +106,8 @@ public:
         case Texture::Format_RGB8_SRGB:
             return VK_FORMAT_R8G8B8_SRGB;
         case Texture::Format_A8_SRGB:
-            return VK_FORMAT_R8_SRGB;
+            // Alpha and distance fields are linear, as GL_R8 on OpenGL
+            return VK_FORMAT_R8_UNORM;
         default:
             assert(!"Invalid texture format");
             return VK_FORMAT_UNDEFINED;
@@ -104,17 +135,26 @@ protected:
 
         void* hostMapping; // Host memory mapping of the buffer
         uint32_t size;     // How many vertexes can fit in buffer
+
+        void* handle = nullptr; // In m_vertexBuffers or m_transientBlocks
     };
 
     void purge_destroyed_textures();
 
+    // Record an upload of the whole texture, the texture may be bound right away
+    void upload_texture(VulkanTexture* texture, const void* data);
+
     std::mutex m_bufferDestroyLock;
-    std::vector<std::pair<VkBuffer, VmaAllocation>> m_buffersPendingDestruction;
+    // Buffers released while recording a frame may still be read by every frame in flight,
+    // they are destroyed once the same frame begins again
+    std::vector<std::pair<VkBuffer, VmaAllocation>>
+        m_buffersPendingDestruction[RENDERING_VULKANRENDERER_MAX_FRAMES_IN_FLIGHT];
     std::mutex m_textureDestroyLock;
     std::vector<VulkanTexture*> m_texturesPendingDestruction;
 
     inline VkDevice GetDevice() { return m_device; }
     inline VkRenderPass GetRenderPass() { return m_renderPass; }
+    inline VkPipelineCache GetPipelineCache() { return m_pipelineCache; }
     inline VkExtent2D GetScreenExtent() const { return m_swapExtent; }
     inline VmaAllocator Allocator() { return m_alloc; }
 
@@ -124,11 +164,24 @@ protected:
 
     void do_draw_call(unsigned firstVertex, unsigned vertexCount, const Matrix4& transform,
                       const Matrix4& view) override;
-
-    std::set<VulkanTexture*> m_textures;
-    std::set<VulkanPipeline*> m_pipelines;
-    std::set<VertexBuffer*> m_vertexBuffers;
+    void do_draw_indexed_call(unsigned firstVertex, unsigned indexCount, const Matrix4& transform,
+                              const Matrix4& view) override;
+
+    void upload_instances(const SpriteInstance* instances, unsigned count) override;
+    void do_draw_instanced_call(unsigned firstInstance, unsigned instanceCount,
+                                const Matrix4& view) override;
+
+    // Resources are created from any thread (e.g. texture loading jobs),
+    // held while inserting into or erasing from the tables and the bindless slot lists
+    std::mutex m_resourceLock;
+    HandleTable<VulkanTexture> m_textures;
+    HandleTable<VulkanPipeline> m_pipelines;
+    HandleTable<VertexBuffer> m_vertexBuffers;
     RenderPipeline* m_defaultPipeline = nullptr;
+    RenderPipeline* m_defaultBatchPipeline = nullptr;
+    RenderPipeline* m_defaultInstancedPipeline = nullptr;
+    RenderPipeline* m_defaultSDFPipeline = nullptr;
+    RenderPipeline* m_defaultSDFInstancedPipeline = nullptr;
 
     // For now all pipelines are required to have the same descriptor set layout
     // TODO: More configurable pipelines
@@ -174,6 +227,10 @@ private:
         VkCommandBuffer commandBuffer;
 
         std::unique_ptr<DescriptorPool> uboDescriptorPool;
+
+        // Persistently mapped transient blocks,
+        // reset by BeginFrame once the fence shows the GPU is done with them
+        TransientChain transientChain{RENDERING_VULKANRENDERER_TRANSIENT_RING_SIZE};
     };
 
     // Ready frame for drawing
@@ -188,11 +245,23 @@ private:
     int GPUSuitability(VkPhysicalDevice dev);
 
     std::optional<uint32_t> GetGraphicsQueueFamily();
+    // Family of a transfer only queue, if the GPU has one
+    std::optional<uint32_t> GetTransferQueueFamily();
     SwapChainInfo GetSwapChainInfo();
 
     int CreateLogicalDevice();
     void CreateCommandPools();
 
+    // Check for the descriptor indexing features the bindless texture table needs
+    // and pick its size, features are enabled in usedFeatures
+    bool QueryBindlessTextures(VkPhysicalDeviceVulkan12Features& usedFeatures);
+
+    // Create the pipeline cache shared by every pipeline,
+    // starting from the cache file if it was written by the same device and driver
+    void LoadPipelineCache();
+    // Write the pipeline cache back to the cache file
+    void SavePipelineCache();
+
     struct UniformBufferObject {
         // One set per frame
         VkDescriptorSet descriptorSets[RENDERING_VULKANRENDERER_MAX_FRAMES_IN_FLIGHT];
@@ -204,6 +273,11 @@ private:
     VkDescriptorSet allocate_descriptor_set(DescriptorPool* pool);
     void free_descriptor_set(DescriptorPool* pool, VkDescriptorSet set);
 
+    void create_bindless_texture_table();
+    // Write the texture into a free slot of the bindless texture table
+    // expects m_resourceLock to be held
+    void add_bindless_texture(VulkanTexture* texture);
+
     // Begin recording command buffer
     void BeginCommandBuffer();
     // Finish recording command buffer
@@ -218,6 +292,45 @@ private:
     void _create_vertex_buffer(VertexBuffer* buffer, uint32_t vertexCount);
     void _destroy_vertex_buffer(VertexBuffer* buffer);
 
+    // Bind pipeline, texture and vertex buffer state and push the transforms for a draw,
+    // returns false if the draw should be skipped
+    bool prepare_draw(const Matrix4& transform, const Matrix4& view);
+    // Bind pipeline and texture state and push the viewport and canvas transforms,
+    // returns false if the draw should be skipped.
+    // Instanced draws without a texture sample the texture of each instance on bindless pipelines.
+    bool prepare_pipeline(const Matrix4& view, bool instanced = false);
+
+    // Create a host visible, persistently mapped buffer, returns the mapping
+    void* create_mapped_buffer(VkDeviceSize size, VkBufferUsageFlags usage, VkBuffer& buffer,
+                               VmaAllocation& allocation);
+
+    // Make sure the quad index buffer can hold quadCount quads
+    void reserve_quad_indices(uint32_t quadCount);
+
+    // Usable as a vertex, index or instance buffer
+    TransientBlock create_transient_block(size_t size) override;
+    // Destroys the block right away, the GPU must be done with it
+    void destroy_transient_block(const TransientBlock& block) override;
+
+    // Shared index buffer for draw_quads, indices are 0, 1, 2, 2, 1, 3 for each quad
+    VkBuffer m_quadIndexBuffer = VK_NULL_HANDLE;
+    VmaAllocation m_quadIndexAllocation = VK_NULL_HANDLE;
+    uint32_t m_quadIndexCapacity = 0; // In quads
+
+    // Unit quad every SpriteInstance is drawn as
+    VkBuffer m_unitQuadBuffer = VK_NULL_HANDLE;
+    VmaAllocation m_unitQuadAllocation = VK_NULL_HANDLE;
+
+    // Transient memory is allocated from any thread
+    std::mutex m_transientLock;
+    // Blocks of every transient ring, tagged apart from m_vertexBuffers
+    // as both are bound through bind_vertex_buffer()
+    HandleTable<VertexBuffer> m_transientBlocks{1};
+
+    // Instances of the frame, uploaded to the transient ring by upload_instances
+    VkBuffer m_instanceBuffer = VK_NULL_HANDLE;
+    VkDeviceSize m_instanceOffset = 0;
+
     const std::string m_rendererName = "Vulkan";
 
     WindowContext* m_windowContext = nullptr;
@@ -259,9 +372,32 @@ private:
     VulkanTexture* m_boundTexture = nullptr;
 
     VertexBuffer* m_boundVertexBuffer = nullptr;
+    // Last vertex buffer bound in each frame's command buffer
+    VertexBuffer* m_lastVertexBuffers[RENDERING_VULKANRENDERER_MAX_FRAMES_IN_FLIGHT];
 
     std::unique_ptr<DescriptorPool> m_textureDescriptorPool;
 
+    // Bindless texture table, an array of combined image samplers holding every texture
+    // in a single descriptor set. A slot is written when its texture is created,
+    // bindless pipelines bind the set once and push the slot of each draw.
+    bool m_bindlessTextures = false;
+    uint32_t m_bindlessCapacity = 0;
+    VkDescriptorSetLayout m_bindlessSetLayout = VK_NULL_HANDLE;
+    VkDescriptorPool m_bindlessPool = VK_NULL_HANDLE;
+    VkDescriptorSet m_bindlessSet = VK_NULL_HANDLE;
+    // Slots of destroyed textures, the device is idle by the time a texture is destroyed.
+    // Guarded by m_resourceLock
+    std::vector<uint32_t> m_freeBindlessSlots;
+    uint32_t m_nextBindlessSlot = 0;
+    // 1x1 white texture in slot 0, sampled by draws without a texture
+    VulkanTexture* m_whiteTexture = nullptr;
+    // The frame being recorded samples the texture of each instance,
+    // so it may sample any texture
+    bool m_frameSamplesInstanceTextures = false;
+    // Frame timeline value of the last frame sampling the texture of each instance,
+    // every upload waits for it. Read by uploads from any thread
+    std::atomic<uint64_t> m_instanceTextureFrame = 0;
+
     std::vector<VkImage> m_images; // Swapchain image handles
     std::vector<VkImageView> m_imageViews;
     std::vector<VkFramebuffer> m_framebuffers; // Swapchain framebuffers
@@ -269,6 +405,21 @@ private:
     VkDevice m_device = VK_NULL_HANDLE; // Logical device
     VkQueue m_graphicsQueue;            // Graphics queue
     uint32_t m_graphicsQueueFamily;
+    VkQueue m_transferQueue; // Texture uploads, the graphics queue without a transfer queue
+    uint32_t m_transferQueueFamily;
+    // Held while submitting to or waiting on a queue, the uploader submits from any thread
+    mutable std::mutex m_queueLock;
+
+    // Shared by every pipeline
+    VkPipelineCache m_pipelineCache = VK_NULL_HANDLE;
+    std::string m_pipelineCachePath; // Empty if the cache is not kept between launches
+
+    std::unique_ptr<VulkanUploader> m_uploader;
+    // Timeline semaphore signalled with the number of frames submitted
+    VkSemaphore m_frameTimeline = VK_NULL_HANDLE;
+    uint64_t m_frameValue = 0;
+    // Upload timeline value the frame being recorded waits for before sampling textures
+    uint64_t m_frameUploadWait = 0;
 
     std::vector<VkCommandPool> m_commandPools; // Command pool
     std::vector<VkCommandBuffer> m_commandBuffers;
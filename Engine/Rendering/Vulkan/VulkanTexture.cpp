@@ -3,7 +3,6 @@
 #include "VulkanPrivate.h"
 #include "VulkanRenderer.h"
 
-#include <Arclight/Colour.h>
 #include <Arclight/Core/Fatal.h>
 #include <Arclight/Core/Logger.h>
 
@@ -11,38 +10,9 @@ namespace Arclight::Rendering {
 
 VulkanTexture::VulkanTexture(VulkanRenderer& renderer, const Vector2u& bounds, VkFormat texFormat)
     : m_renderer(renderer), m_bounds(bounds), m_format(texFormat) {
-    VkBufferCreateInfo stagingBufferCreateInfo = {
-        .sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
-        .pNext = nullptr,
-        .flags = 0,
-        .size = sizeof(RGBAColour) * bounds.x * bounds.y,
-        .usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
-        .sharingMode = VK_SHARING_MODE_EXCLUSIVE,
-        .queueFamilyIndexCount = 0,
-        .pQueueFamilyIndices = nullptr,
-    };
-
-    VmaAllocationCreateInfo stagingBufferAllocCreateInfo = {
-        .flags = VMA_ALLOCATION_CREATE_MAPPED_BIT,
-        .usage = VMA_MEMORY_USAGE_CPU_ONLY,
-        .requiredFlags = 0,
-        .preferredFlags = 0,
-        .memoryTypeBits = 0,
-        .pool = 0,
-        .pUserData = nullptr,
-        .priority = 0.0f,
-    };
-
-    VmaAllocationInfo stagingAllocInfo;
-    vkCheck(vmaCreateBuffer(m_renderer.Allocator(), &stagingBufferCreateInfo,
-                            &stagingBufferAllocCreateInfo, &m_staging, &m_stagingAllocation,
-                            &stagingAllocInfo));
-
-    m_stagingMap = stagingAllocInfo.pMappedData;
-    for (unsigned i = 0; i < bounds.x * bounds.y; i++) {
-        reinterpret_cast<uint32_t*>(m_stagingMap)[i] = __builtin_bswap32(
-            RGBAColour(255, 255, 0, 255).value); // Fill missing textures with pink
-    }
+    const uint32_t queueFamilies[2] = {m_renderer.m_graphicsQueueFamily,
+                                       m_renderer.m_transferQueueFamily};
+    const bool sharedWithTransfer = queueFamilies[0] != queueFamilies[1];
 
     VkImageCreateInfo imageCreateInfo = {
         .sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO,
@@ -61,9 +31,11 @@ VulkanTexture::VulkanTexture(VulkanRenderer& renderer, const Vector2u& bounds, V
         .samples = VK_SAMPLE_COUNT_1_BIT,  // No multisampling
         .tiling = VK_IMAGE_TILING_OPTIMAL, // Most efficient, may not be row-major
         .usage = VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT,
-        .sharingMode = VK_SHARING_MODE_EXCLUSIVE,
-        .queueFamilyIndexCount = 0,
-        .pQueueFamilyIndices = nullptr,
+        // Shared with the transfer queue if it has its own family,
+        // so uploads need no queue family ownership transfers
+        .sharingMode = sharedWithTransfer ? VK_SHARING_MODE_CONCURRENT : VK_SHARING_MODE_EXCLUSIVE,
+        .queueFamilyIndexCount = sharedWithTransfer ? 2u : 0u,
+        .pQueueFamilyIndices = sharedWithTransfer ? queueFamilies : nullptr,
         .initialLayout = VK_IMAGE_LAYOUT_UNDEFINED, // Discard texels on image transition
     };
 
@@ -81,8 +53,8 @@ VulkanTexture::VulkanTexture(VulkanRenderer& renderer, const Vector2u& bounds, V
     vkCheck(vmaCreateImage(m_renderer.Allocator(), &imageCreateInfo, &imageAllocCreateInfo,
                            &m_image, &m_imageAllocation, nullptr));
 
-    requireLayoutTransition = true;
-    UpdateTextureImage();
+    // Texels are undefined until the first update, staging memory is only used by uploads
+    m_uploadValue = m_renderer.m_uploader->prepare_image(m_image);
 
     VkComponentMapping componentMapping;
     if (texFormat == VK_FORMAT_R8G8B8A8_SRGB) {
@@ -99,7 +71,7 @@ VulkanTexture::VulkanTexture(VulkanRenderer& renderer, const Vector2u& bounds, V
             .b = VK_COMPONENT_SWIZZLE_IDENTITY,
             .a = VK_COMPONENT_SWIZZLE_ONE,
         };
-    } else if (texFormat == VK_FORMAT_R8_SRGB) {
+    } else if (texFormat == VK_FORMAT_R8_UNORM) {
         // Use red as alpha
         componentMapping = {
             .r = VK_COMPONENT_SWIZZLE_ONE,
@@ -171,72 +143,19 @@ VulkanTexture::~VulkanTexture() {
     vkDestroyImageView(m_renderer.GetDevice(), m_imageView, nullptr);
 
     vmaDestroyImage(m_renderer.Allocator(), m_image, m_imageAllocation);
-    vmaDestroyBuffer(m_renderer.Allocator(), m_staging, m_stagingAllocation);
-}
-
-void VulkanTexture::LayoutTransition(VkCommandBuffer commandBuffer, VkImageLayout oldLayout,
-                                     VkImageLayout newLayout) {
-    VulkanImageLayoutTransition(commandBuffer, m_image, oldLayout, newLayout);
 }
 
-void VulkanTexture::UpdateTextureBuffer(const void* data) {
-    int formatSize = 4;
+uint32_t VulkanTexture::TexelSize() const {
     switch (m_format) {
     case VK_FORMAT_R8G8B8A8_SRGB:
-        formatSize = 4;
-        break;
+        return 4;
     case VK_FORMAT_R8G8B8_SRGB:
-        formatSize = 3;
-        break;
-    case VK_FORMAT_R8_SRGB:
-        formatSize = 1;
-        break;
+        return 3;
+    case VK_FORMAT_R8_UNORM:
+        return 1;
     default:
         assert(!"Invalid texture VkFormat");
-        break;
-    }
-
-    memcpy(m_stagingMap, data, formatSize * m_bounds.x * m_bounds.y);
-}
-
-void VulkanTexture::UpdateTextureImage() {
-    auto commandBuffer =
-        m_renderer
-            .CreateOneTimeCommandBuffer(); // Get a one-time command buffer for our copy operation
-
-    VkBufferImageCopy copyInfo = {
-        .bufferOffset = 0,
-        .bufferRowLength = 0,
-        .bufferImageHeight = 0,
-        .imageSubresource{
-            .aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
-            .mipLevel = 0,
-            .baseArrayLayer = 0,
-            .layerCount = 1,
-        },
-        .imageOffset = {0, 0, 0},
-        .imageExtent = {m_bounds.x, m_bounds.y, 1},
-    };
-
-    if (requireLayoutTransition) {
-        LayoutTransition(commandBuffer.Buffer(), VK_IMAGE_LAYOUT_UNDEFINED,
-                         VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
-
-        vkCmdCopyBufferToImage(commandBuffer.Buffer(), m_staging, m_image,
-                               VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &copyInfo);
-
-        LayoutTransition(commandBuffer.Buffer(), VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-                         VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
-        requireLayoutTransition = false;
-    } else {
-        LayoutTransition(commandBuffer.Buffer(), VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
-                         VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
-
-        vkCmdCopyBufferToImage(commandBuffer.Buffer(), m_staging, m_image,
-                               VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &copyInfo);
-
-        LayoutTransition(commandBuffer.Buffer(), VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-                         VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+        return 4;
     }
 }
 
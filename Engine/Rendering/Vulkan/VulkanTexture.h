@@ -2,6 +2,8 @@
 
 #include <vulkan/vulkan_core.h>
 
+#include <atomic>
+
 #include <Arclight/Vector.h>
 
 #include "VulkanMemory.h"
@@ -9,53 +11,31 @@
 namespace Arclight::Rendering {
 
 class VulkanTexture final {
+	friend class VulkanRenderer;
+
 public:
 	VulkanTexture(class VulkanRenderer& renderer, const Vector2u& bounds, VkFormat texFormat);
 	~VulkanTexture();
 
 	////////////////////////////////////////
-	/// Returns the staging buffer mapping for the texture.
-	///
-	/// \return Pointer to mapped staging buffer
-	///
-	/// \note This buffer is CPU-only. Call UpdateTextureImage to update the GPU copy.
-	////////////////////////////////////////
-	inline void* Buffer() { return m_stagingMap; }
-
-	////////////////////////////////////////
-	/// Update the staging buffer
-	///
-	/// \param data New pixel data
-	////////////////////////////////////////
-	void UpdateTextureBuffer(const void* data);
-
-	////////////////////////////////////////
-	/// Update the VkImage for a texture using the staging buffer.
+	/// \return Size of a texel in bytes
 	////////////////////////////////////////
-	void UpdateTextureImage();
+	uint32_t TexelSize() const;
 
 	inline const VkDescriptorImageInfo& DescriptorImageInfo() const { return m_descriptorImageInfo; }; // Used to update descriptor sets for the fragment shader
 
 private:
-	////////////////////////////////////////
-	/// Transition the image layout using an image memory barrier.
-	///
-	/// \param commandBuffer Command buffer
-	/// \param oldLayout Old image layout
-	/// \param newLayout New image layout
-	////////////////////////////////////////
-	void LayoutTransition(VkCommandBuffer commandBuffer, VkImageLayout oldLayout, VkImageLayout newLayout);
-
 	class VulkanRenderer& m_renderer; // Renderer object
 
 	Vector2u m_bounds; // Texture bounds
 
-	bool requireLayoutTransition = true; // Layout transition when updating texture?
-
-	void* m_stagingMap; // Staging buffer host mapping
+	// Upload timeline value signalled once the latest upload retires, set by uploads from any thread
+	std::atomic<uint64_t> m_uploadValue = 0;
+	// Frame timeline value of the last frame sampling the texture, read by uploads from any thread
+	std::atomic<uint64_t> m_lastUseFrame = 0;
 
-	VkBuffer m_staging; // Staging buffer (CPU to GPU)
-	VmaAllocation m_stagingAllocation;
+	uint32_t m_bindlessIndex = 0; // Slot in the bindless texture table
+	bool m_hasBindlessSlot = false; // m_bindlessIndex is owned by the texture
 
 	VkFormat m_format; // Texture format
 
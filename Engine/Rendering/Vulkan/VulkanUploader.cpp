@@ -0,0 +1,396 @@
+#include "VulkanUploader.h"
+#include "VulkanPrivate.h"
+
+#include <Arclight/Core/Fatal.h>
+#include <Arclight/Core/Logger.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <numeric>
+
+namespace Arclight::Rendering {
+
+VulkanUploader::VulkanUploader(VkDevice device, VmaAllocator allocator, VkQueue queue,
+                               uint32_t queueFamily, std::mutex& queueLock,
+                               VkSemaphore frameTimeline)
+    : m_device(device), m_allocator(allocator), m_queue(queue), m_queueLock(queueLock),
+      m_frameTimeline(frameTimeline) {
+    VkSemaphoreTypeCreateInfo timelineInfo = {
+        .sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO,
+        .pNext = nullptr,
+        .semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE,
+        .initialValue = 0,
+    };
+
+    VkSemaphoreCreateInfo semaphoreInfo = {
+        .sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO,
+        .pNext = &timelineInfo,
+        .flags = 0,
+    };
+
+    vkCheck(vkCreateSemaphore(m_device, &semaphoreInfo, nullptr, &m_timeline));
+
+    VkCommandPoolCreateInfo poolInfo = {
+        .sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO,
+        .pNext = nullptr,
+        .flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT |
+                 VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT, // Buffers are reset one by one
+        .queueFamilyIndex = queueFamily,
+    };
+
+    vkCheck(vkCreateCommandPool(m_device, &poolInfo, nullptr, &m_commandPool));
+
+    VkBufferCreateInfo stagingCreateInfo = {
+        .sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
+        .pNext = nullptr,
+        .flags = 0,
+        .size = RENDERING_VULKANUPLOADER_STAGING_SIZE,
+        .usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+        .sharingMode = VK_SHARING_MODE_EXCLUSIVE,
+        .queueFamilyIndexCount = 0,
+        .pQueueFamilyIndices = nullptr,
+    };
+
+    VmaAllocationCreateInfo stagingAllocCreateInfo = {
+        .flags = VMA_ALLOCATION_CREATE_MAPPED_BIT,
+        .usage = VMA_MEMORY_USAGE_CPU_ONLY,
+        .requiredFlags = 0,
+        .preferredFlags = 0,
+        .memoryTypeBits = 0,
+        .pool = 0,
+        .pUserData = nullptr,
+        .priority = 0.0f,
+    };
+
+    VmaAllocationInfo stagingAllocInfo;
+    vkCheck(vmaCreateBuffer(m_allocator, &stagingCreateInfo, &stagingAllocCreateInfo, &m_staging,
+                            &m_stagingAllocation, &stagingAllocInfo));
+
+    m_stagingMap = reinterpret_cast<uint8_t*>(stagingAllocInfo.pMappedData);
+}
+
+VulkanUploader::~VulkanUploader() {
+    // Nothing in the open batch was submitted, its command buffer is freed with the pool
+    for (auto& buffer : m_open.dedicatedStaging) {
+        vmaDestroyBuffer(m_allocator, buffer.first, buffer.second);
+    }
+
+    if (!m_inFlight.empty()) {
+        wait(m_submittedValue);
+    }
+
+    vkDestroyCommandPool(m_device, m_commandPool, nullptr);
+    vmaDestroyBuffer(m_allocator, m_staging, m_stagingAllocation);
+    vkDestroySemaphore(m_device, m_timeline, nullptr);
+}
+
+uint64_t VulkanUploader::upload_image(VkImage image, const Vector2u& bounds, uint32_t texelSize,
+                                      const void* data, uint64_t waitFrame) {
+    const VkDeviceSize size = static_cast<VkDeviceSize>(texelSize) * bounds.x * bounds.y;
+
+    std::scoped_lock lock(m_lock);
+
+    uint64_t completedValue;
+    vkCheck(vkGetSemaphoreCounterValue(m_device, m_timeline, &completedValue));
+    retire(completedValue);
+
+    VkBuffer source = m_staging;
+    VkDeviceSize offset = 0;
+    if (size > RENDERING_VULKANUPLOADER_STAGING_SIZE) {
+        VkBufferCreateInfo stagingCreateInfo = {
+            .sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
+            .pNext = nullptr,
+            .flags = 0,
+            .size = size,
+            .usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+            .sharingMode = VK_SHARING_MODE_EXCLUSIVE,
+            .queueFamilyIndexCount = 0,
+            .pQueueFamilyIndices = nullptr,
+        };
+
+        VmaAllocationCreateInfo stagingAllocCreateInfo = {
+            .flags = VMA_ALLOCATION_CREATE_MAPPED_BIT,
+            .usage = VMA_MEMORY_USAGE_CPU_ONLY,
+            .requiredFlags = 0,
+            .preferredFlags = 0,
+            .memoryTypeBits = 0,
+            .pool = 0,
+            .pUserData = nullptr,
+            .priority = 0.0f,
+        };
+
+        VmaAllocation allocation;
+        VmaAllocationInfo allocInfo;
+        vkCheck(vmaCreateBuffer(m_allocator, &stagingCreateInfo, &stagingAllocCreateInfo, &source,
+                                &allocation, &allocInfo));
+
+        memcpy(allocInfo.pMappedData, data, size);
+        m_open.dedicatedStaging.push_back({source, allocation});
+    } else {
+        // Buffer offsets of copies must be a multiple of both the texel size and 4
+        const VkDeviceSize alignment = std::lcm<VkDeviceSize>(texelSize, 4);
+        while (!allocate_staging(size, alignment, offset)) {
+            // The ring is full of uploads the GPU has not got to yet
+            assert(m_open.commandBuffer || !m_inFlight.empty());
+            submit();
+            wait(m_inFlight.front().value);
+        }
+
+        memcpy(m_stagingMap + offset, data, size);
+    }
+
+    if (!m_open.commandBuffer) {
+        begin_batch();
+    }
+
+    VkImageMemoryBarrier barrier = {
+        .sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+        .pNext = nullptr,
+        // Earlier uploads to the image in this or a previous batch
+        .srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT,
+        .dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT,
+        .oldLayout = VK_IMAGE_LAYOUT_UNDEFINED, // Every texel is replaced
+        .newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+        .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+        .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+        .image = image,
+        .subresourceRange =
+            {
+                .aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
+                .baseMipLevel = 0,
+                .levelCount = 1,
+                .baseArrayLayer = 0,
+                .layerCount = 1,
+            },
+    };
+
+    vkCmdPipelineBarrier(m_open.commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT,
+                         VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0, nullptr, 1, &barrier);
+
+    VkBufferImageCopy copyInfo = {
+        .bufferOffset = offset,
+        .bufferRowLength = 0,
+        .bufferImageHeight = 0,
+        .imageSubresource{
+            .aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
+            .mipLevel = 0,
+            .baseArrayLayer = 0,
+            .layerCount = 1,
+        },
+        .imageOffset = {0, 0, 0},
+        .imageExtent = {bounds.x, bounds.y, 1},
+    };
+
+    vkCmdCopyBufferToImage(m_open.commandBuffer, source, image,
+                           VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &copyInfo);
+
+    // Transfer queues have no shader stages,
+    // the graphics queue waits on the timeline semaphore before sampling the image
+    barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    barrier.dstAccessMask = 0;
+    barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+    barrier.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+
+    vkCmdPipelineBarrier(m_open.commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT,
+                         VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 0, 0, nullptr, 0, nullptr, 1,
+                         &barrier);
+
+    m_open.waitFrame = std::max(m_open.waitFrame, waitFrame);
+
+    const uint64_t value = m_open.value;
+    m_openBytes += size;
+    if (m_openBytes >= RENDERING_VULKANUPLOADER_BATCH_SIZE) {
+        // Keep the queue busy while the rest is recorded
+        submit();
+    }
+
+    return value;
+}
+
+uint64_t VulkanUploader::prepare_image(VkImage image) {
+    std::scoped_lock lock(m_lock);
+
+    if (!m_open.commandBuffer) {
+        begin_batch();
+    }
+
+    VkImageMemoryBarrier barrier = {
+        .sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+        .pNext = nullptr,
+        .srcAccessMask = 0,
+        .dstAccessMask = 0,
+        .oldLayout = VK_IMAGE_LAYOUT_UNDEFINED,
+        .newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+        .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+        .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+        .image = image,
+        .subresourceRange =
+            {
+                .aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
+                .baseMipLevel = 0,
+                .levelCount = 1,
+                .baseArrayLayer = 0,
+                .layerCount = 1,
+            },
+    };
+
+    vkCmdPipelineBarrier(m_open.commandBuffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+                         VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 0, 0, nullptr, 0, nullptr, 1,
+                         &barrier);
+
+    return m_open.value;
+}
+
+void VulkanUploader::flush() {
+    std::scoped_lock lock(m_lock);
+    submit();
+}
+
+void VulkanUploader::submit() {
+    if (!m_open.commandBuffer) {
+        return;
+    }
+
+    vkCheck(vkEndCommandBuffer(m_open.commandBuffer));
+
+    const uint64_t waitValues[] = {m_open.waitFrame};
+    const uint64_t signalValues[] = {m_open.value};
+    VkTimelineSemaphoreSubmitInfo timelineInfo = {
+        .sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO,
+        .pNext = nullptr,
+        .waitSemaphoreValueCount = 1,
+        .pWaitSemaphoreValues = waitValues,
+        .signalSemaphoreValueCount = 1,
+        .pSignalSemaphoreValues = signalValues,
+    };
+
+    const VkPipelineStageFlags waitStages[] = {VK_PIPELINE_STAGE_TRANSFER_BIT};
+    VkSubmitInfo submitInfo = {
+        .sType = VK_STRUCTURE_TYPE_SUBMIT_INFO,
+        .pNext = &timelineInfo,
+        .waitSemaphoreCount = 1,
+        .pWaitSemaphores = &m_frameTimeline,
+        .pWaitDstStageMask = waitStages,
+        .commandBufferCount = 1,
+        .pCommandBuffers = &m_open.commandBuffer,
+        .signalSemaphoreCount = 1,
+        .pSignalSemaphores = &m_timeline,
+    };
+
+    {
+        std::scoped_lock lockQueue(m_queueLock);
+        vkCheck(vkQueueSubmit(m_queue, 1, &submitInfo, VK_NULL_HANDLE));
+    }
+
+    m_submittedValue.store(m_open.value, std::memory_order_release);
+    m_open.stagingEnd = m_stagingHead;
+    m_inFlight.push_back(std::move(m_open));
+
+    m_open = Batch();
+    m_openBytes = 0;
+}
+
+bool VulkanUploader::allocate_staging(VkDeviceSize size, VkDeviceSize alignment,
+                                      VkDeviceSize& offset) {
+    assert(size <= RENDERING_VULKANUPLOADER_STAGING_SIZE);
+
+    if (!m_stagingUsed) {
+        // Start over at the beginning while the ring is empty
+        m_stagingHead = m_stagingTail = 0;
+    }
+
+    const VkDeviceSize start = (m_stagingHead + alignment - 1) / alignment * alignment;
+    if (m_stagingHead > m_stagingTail || !m_stagingUsed) {
+        // Free space is after the head and before the tail
+        if (start + size <= RENDERING_VULKANUPLOADER_STAGING_SIZE) {
+            offset = start;
+        } else if (size <= m_stagingTail) {
+            offset = 0; // Wrap around, the end of the ring is padding
+        } else {
+            return false;
+        }
+    } else if (m_stagingHead < m_stagingTail && start + size <= m_stagingTail) {
+        offset = start;
+    } else {
+        return false;
+    }
+
+    // Padding is released along with the batch
+    const VkDeviceSize used = (offset >= m_stagingHead)
+                                  ? offset + size - m_stagingHead
+                                  : RENDERING_VULKANUPLOADER_STAGING_SIZE - m_stagingHead + size;
+    m_stagingUsed += used;
+    m_open.stagingSize += used;
+    m_stagingHead = offset + size;
+
+    return true;
+}
+
+void VulkanUploader::begin_batch() {
+    if (m_freeCommandBuffers.empty()) {
+        VkCommandBufferAllocateInfo bufferInfo = {
+            .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
+            .pNext = nullptr,
+            .commandPool = m_commandPool,
+            .level = VK_COMMAND_BUFFER_LEVEL_PRIMARY,
+            .commandBufferCount = 1,
+        };
+
+        vkCheck(vkAllocateCommandBuffers(m_device, &bufferInfo, &m_open.commandBuffer));
+    } else {
+        m_open.commandBuffer = m_freeCommandBuffers.back();
+        m_freeCommandBuffers.pop_back();
+
+        vkCheck(vkResetCommandBuffer(m_open.commandBuffer, 0));
+    }
+
+    VkCommandBufferBeginInfo beginInfo = {
+        .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+        .pNext = nullptr,
+        .flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT,
+        .pInheritanceInfo = nullptr,
+    };
+
+    vkCheck(vkBeginCommandBuffer(m_open.commandBuffer, &beginInfo));
+
+    m_open.value = m_submittedValue + 1;
+}
+
+void VulkanUploader::retire(uint64_t completedValue) {
+    // Batches are submitted to one queue and retire in order
+    while (!m_inFlight.empty() && m_inFlight.front().value <= completedValue) {
+        Batch& batch = m_inFlight.front();
+
+        m_freeCommandBuffers.push_back(batch.commandBuffer);
+        for (auto& buffer : batch.dedicatedStaging) {
+            vmaDestroyBuffer(m_allocator, buffer.first, buffer.second);
+        }
+
+        // Batches without ring memory may predate the ring starting over
+        if (batch.stagingSize) {
+            m_stagingTail = batch.stagingEnd;
+            m_stagingUsed -= batch.stagingSize;
+        }
+
+        m_inFlight.pop_front();
+    }
+}
+
+void VulkanUploader::wait(uint64_t value) {
+    assert(value <= m_submittedValue);
+
+    VkSemaphoreWaitInfo waitInfo = {
+        .sType = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO,
+        .pNext = nullptr,
+        .flags = 0,
+        .semaphoreCount = 1,
+        .pSemaphores = &m_timeline,
+        .pValues = &value,
+    };
+
+    vkCheck(vkWaitSemaphores(m_device, &waitInfo, UINT64_MAX));
+    retire(value);
+}
+
+} // namespace Arclight::Rendering
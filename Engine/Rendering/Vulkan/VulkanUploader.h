@@ -0,0 +1,138 @@
+#pragma once
+
+#include <vulkan/vulkan_core.h>
+
+#include <Arclight/Core/NonCopyable.h>
+#include <Arclight/Vector.h>
+
+#include "VulkanMemory.h"
+
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+// Size of the staging ring shared by every texture upload in bytes,
+// larger uploads get a staging buffer of their own
+#define RENDERING_VULKANUPLOADER_STAGING_SIZE (16 * 1024 * 1024)
+// Bytes of staging memory a batch records before it is submitted
+// without waiting for the end of the frame
+#define RENDERING_VULKANUPLOADER_BATCH_SIZE (4 * 1024 * 1024)
+
+namespace Arclight::Rendering {
+
+////////////////////////////////////////
+/// \brief Uploads image data without blocking the caller
+///
+/// Pixels are copied into a persistently mapped staging ring
+/// and the copies are recorded into the command buffer of the open batch.
+/// The batch is submitted at the end of each frame, or earlier once it gets large,
+/// and signals the next value of a timeline semaphore when it retires.
+/// Staging memory and command buffers are reused once their batch has retired.
+///
+/// Images uploaded on a queue of another family must be created with concurrent sharing.
+///
+/// May be used from any thread, recording and submission are serialised by the uploader.
+////////////////////////////////////////
+class VulkanUploader final : NonCopyable {
+public:
+    ////////////////////////////////////////
+    /// \param queue Queue copies are submitted to, a dedicated transfer queue where available
+    /// \param queueLock Held while submitting to queue, which may be shared with the renderer
+    /// \param frameTimeline Timeline semaphore signalled by every graphics frame,
+    /// uploads wait on it for frames still sampling the previous contents of an image
+    ////////////////////////////////////////
+    VulkanUploader(VkDevice device, VmaAllocator allocator, VkQueue queue, uint32_t queueFamily,
+                   std::mutex& queueLock, VkSemaphore frameTimeline);
+    // Waits for every submitted batch to retire
+    ~VulkanUploader();
+
+    ////////////////////////////////////////
+    /// \brief Record an upload replacing the whole contents of an image
+    ///
+    /// The image is left in VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL.
+    /// Only blocks when the staging ring is full of uploads which have not retired.
+    ///
+    /// \param texelSize Size of a texel in bytes
+    /// \param data Tightly packed texels, copied before returning
+    /// \param waitFrame Frame timeline value to wait for before the image is overwritten
+    ///
+    /// \return Upload timeline value signalled once the upload has retired
+    ////////////////////////////////////////
+    uint64_t upload_image(VkImage image, const Vector2u& bounds, uint32_t texelSize,
+                          const void* data, uint64_t waitFrame);
+
+    ////////////////////////////////////////
+    /// \brief Record the transition of a new image to VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL
+    ///
+    /// Lets the image be sampled before its first upload, its texels are undefined until then.
+    ///
+    /// \return Upload timeline value signalled once the transition has retired
+    ////////////////////////////////////////
+    uint64_t prepare_image(VkImage image);
+
+    ////////////////////////////////////////
+    /// \brief Submit the open batch, if anything was recorded
+    ////////////////////////////////////////
+    void flush();
+
+    // Timeline semaphore signalled by every batch as it retires
+    inline VkSemaphore timeline() const { return m_timeline; }
+    // Upload timeline value of the last batch submitted
+    inline uint64_t submitted_value() const {
+        return m_submittedValue.load(std::memory_order_acquire);
+    }
+
+private:
+    struct Batch {
+        VkCommandBuffer commandBuffer = VK_NULL_HANDLE;
+        uint64_t value = 0;     // Signalled on the upload timeline once the batch retires
+        uint64_t waitFrame = 0; // Frame timeline value waited for before the copies
+
+        VkDeviceSize stagingEnd = 0;  // Head of the staging ring after the batch
+        VkDeviceSize stagingSize = 0; // Bytes of the ring used, including padding
+        // Uploads larger than the ring
+        std::vector<std::pair<VkBuffer, VmaAllocation>> dedicatedStaging;
+    };
+
+    // Submit the open batch, expects m_lock to be held
+    void submit();
+    // Allocate from the staging ring, returns false if there is not enough free space
+    bool allocate_staging(VkDeviceSize size, VkDeviceSize alignment, VkDeviceSize& offset);
+    // Start recording the open batch
+    void begin_batch();
+    // Release the staging memory and command buffers of batches that have retired
+    void retire(uint64_t completedValue);
+    // Block until the batch signalling value has retired
+    void wait(uint64_t value);
+
+    VkDevice m_device;
+    VmaAllocator m_allocator;
+    VkQueue m_queue;
+    std::mutex& m_queueLock;
+    VkSemaphore m_frameTimeline;
+
+    // Held by every public function but timeline() and submitted_value()
+    std::mutex m_lock;
+
+    VkSemaphore m_timeline = VK_NULL_HANDLE;
+    std::atomic<uint64_t> m_submittedValue = 0;
+
+    VkCommandPool m_commandPool = VK_NULL_HANDLE;
+    std::vector<VkCommandBuffer> m_freeCommandBuffers;
+
+    VkBuffer m_staging = VK_NULL_HANDLE;
+    VmaAllocation m_stagingAllocation = VK_NULL_HANDLE;
+    uint8_t* m_stagingMap = nullptr;
+    // Allocations are made at the head and retire from the tail
+    VkDeviceSize m_stagingHead = 0;
+    VkDeviceSize m_stagingTail = 0;
+    VkDeviceSize m_stagingUsed = 0;
+
+    Batch m_open;                 // Batch being recorded
+    VkDeviceSize m_openBytes = 0; // Bytes uploaded by the open batch
+    std::deque<Batch> m_inFlight; // Submitted batches, oldest first
+};
+
+} // namespace Arclight::Rendering
@@ -31,6 +31,10 @@ public:
 
     void destroy_pipeline(RenderPipeline::PipelineHandle) override {}
     RenderPipeline& default_pipeline() override { return *m_defaultPipeline; }
+    RenderPipeline& default_batch_pipeline() override { return *m_defaultPipeline; }
+    RenderPipeline& default_instanced_pipeline() override { return *m_defaultPipeline; }
+    RenderPipeline& default_sdf_pipeline() override { return *m_defaultPipeline; }
+    RenderPipeline& default_sdf_instanced_pipeline() override { return *m_defaultPipeline; }
 
     void draw(void* vertexBuffer, unsigned firstVertex, unsigned vertexCount,
               const Matrix4& transform, Texture::TextureHandle texture,
@@ -54,10 +58,15 @@ public:
     void* get_vertex_buffer_mapping(void* buffer) override { return nullptr; }
     void destroy_vertex_buffer(void* buffer) override {}
 
+    TransientAllocation allocate_transient(size_t) override { return {}; }
+
     const std::string& get_name() const override { return m_name; }
 
 private:
     void do_draw_call(unsigned firstVertex, unsigned vertexCount, const Matrix4& transform) {}
+    void do_draw_indexed_call(unsigned, unsigned, const Matrix4&, const Matrix4&) override {}
+    void upload_instances(const SpriteInstance*, unsigned) override {}
+    void do_draw_instanced_call(unsigned, unsigned, const Matrix4&) override {}
 
     const std::string m_name = "WebGPU";
 
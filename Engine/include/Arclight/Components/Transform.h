@@ -1,5 +1,6 @@
 #pragma once
 
+#include <Arclight/Graphics/PackedTransform2D.h>
 #include <Arclight/Graphics/Transform.h>
 
 namespace Arclight {
@@ -9,6 +10,9 @@ namespace Components {
 // For now Transform component is analogous to the Transform object
 using Transform2D = ::Arclight::Transform2D;
 
+// Transform kept in structure of arrays storage, matrices are rebuilt by Systems::transform_2d
+using PackedTransform2D = ::Arclight::PackedTransform2D;
+
 } // namespace Components
 
 } // namespace Arclight
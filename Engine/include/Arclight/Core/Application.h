@@ -2,6 +2,7 @@
 
 #include <Arclight/Core/Input.h>
 #include <Arclight/Core/ResourceManager.h>
+#include <Arclight/Core/Task.h>
 #include <Arclight/Core/ThreadPool.h>
 #include <Arclight/Core/Timer.h>
 #include <Arclight/Core/Util.h>
@@ -12,6 +13,8 @@
 #include <Arclight/Platform/API.h>
 #include <Arclight/Window/WindowContext.h>
 
+#include <array>
+#include <coroutine>
 #include <functional>
 #include <map>
 #include <memory>
@@ -33,6 +36,7 @@ public:
         PreTick,
         Tick,
         PostTick,
+        StageCount, // Not a stage
     };
 
     Application();
@@ -50,6 +54,44 @@ public:
 
     void exit();
 
+    ////////////////////////////////////////
+    /// \brief Get time the main thread was blocked waiting on a stage
+    ///
+    /// Time spent executing jobs on the main thread is not counted,
+    /// only time spent asleep waiting for other threads to finish.
+    ///
+    /// \return Wait time in microseconds of the last run of the stage
+    ////////////////////////////////////////
+    long stage_wait_time(Stage stage) const { return m_stageWaitTimes[static_cast<int>(stage)]; }
+
+    class StageAwaiter {
+    public:
+        StageAwaiter(Application& app, Stage stage) : m_app(app), m_stage(stage) {}
+
+        bool await_ready() const noexcept { return false; }
+
+        template<typename P>
+        void await_suspend(std::coroutine_handle<P> handle) {
+            m_app.add_stage_waiter(m_stage, handle.promise().resume_job());
+        }
+
+        void await_resume() const noexcept {}
+
+    private:
+        Application& m_app;
+        Stage m_stage;
+    };
+
+    ////////////////////////////////////////
+    /// \brief Await the end of the next run of a stage from a Task
+    ///
+    /// The task is resumed on the main thread once the systems of the stage have finished,
+    /// before the commands of the stage are replayed. Its commands are replayed after those
+    /// of the systems.
+    /// e.g. co_await Application::instance().next_stage(Application::Stage::PostTick);
+    ////////////////////////////////////////
+    StageAwaiter next_stage(Stage stage) { return StageAwaiter(*this, stage); }
+
     // For now we do not allow runtime definition of states
     // Ensure states are statically defined by using templates
     template <State s> Application& add_state() {
@@ -59,64 +101,24 @@ public:
         return *this;
     }
 
-    template<void(*Function)(float, ::Arclight::World&), Stage when = Stage::Tick, State s = StateNone>
-    ALWAYS_INLINE Application& add_system() {
-        if constexpr(s == StateNone){
-            if constexpr(when == Stage::Init) {
-                m_globalSystems.init.push_back(new System<Function>());
-            } else if constexpr(when == Stage::Exit) {
-                m_globalSystems.exit.push_back(new System<Function>());
-            } else if constexpr(when == Stage::PostTick) {
-                m_globalSystems.posttick.push_back(new System<Function>());
-            } else if constexpr(when == Stage::Tick) {
-                m_globalSystems.tick.push_back(new System<Function>());
-            } else if constexpr(when == Stage::PreTick) {
-                m_globalSystems.pretick.push_back(new System<Function>());
-            }
-        } else {
-            if constexpr(when == Stage::Init) {
-                m_states.at(s).init.push_back(new System<Function>());
-            } else if constexpr(when == Stage::Exit) {
-                m_states.at(s).exit.push_back(new System<Function>());
-            } else if constexpr(when == Stage::PostTick) {
-                m_states.at(s).posttick.push_back(new System<Function>());
-            } else if constexpr(when == Stage::Tick) {
-                m_states.at(s).tick.push_back(new System<Function>());
-            } else if constexpr(when == Stage::PreTick) {
-                m_states.at(s).pretick.push_back(new System<Function>());
-            }
-        }
+    ////////////////////////////////////////
+    /// \brief Add a system to run every stage
+    ///
+    /// Systems may declare the components they access with Reads and Writes,
+    /// e.g. add_system<move_balls>(Reads<Velocity>(), Writes<Transform2D>()).
+    /// Systems which do not conflict run concurrently, conflicting systems run in the order
+    /// they were added. Systems without declared access run alone.
+    ////////////////////////////////////////
+    template<void(*Function)(float, ::Arclight::World&), Stage when = Stage::Tick, State s = StateNone, typename... Access>
+    ALWAYS_INLINE Application& add_system(Access... access) {
+        system_stage<when, s>().add(std::make_unique<System<Function>>(), SystemAccess::from(access...));
 
         return *this;
     }
 
-    template<class Clazz, void(Clazz::*Function)(float, ::Arclight::World&), Stage when = Stage::Tick, State s = StateNone>
-    ALWAYS_INLINE Application& add_system(Clazz& ref) {
-        if constexpr(s == StateNone){
-            if constexpr(when == Stage::Init) {
-                m_globalSystems.init.push_back(new ClassSystem<Clazz, Function>(ref));
-            } else if constexpr(when == Stage::Exit) {
-                m_globalSystems.exit.push_back(new ClassSystem<Clazz, Function>(ref));
-            } else if constexpr(when == Stage::PostTick) {
-                m_globalSystems.posttick.push_back(new ClassSystem<Clazz, Function>(ref));
-            } else if constexpr(when == Stage::Tick) {
-                m_globalSystems.tick.push_back(new ClassSystem<Clazz, Function>(ref));
-            } else if constexpr(when == Stage::PreTick) {
-                m_globalSystems.pretick.push_back(new ClassSystem<Clazz, Function>(ref));
-            }
-        } else {
-            if constexpr(when == Stage::Init) {
-                m_states.at(s).init.push_back(new ClassSystem<Clazz, Function>(ref));
-            } else if constexpr(when == Stage::Exit) {
-                m_states.at(s).exit.push_back(new ClassSystem<Clazz, Function>(ref));
-            } else if constexpr(when == Stage::PostTick) {
-                m_states.at(s).posttick.push_back(new ClassSystem<Clazz, Function>(ref));
-            } else if constexpr(when == Stage::Tick) {
-                m_states.at(s).tick.push_back(new ClassSystem<Clazz, Function>(ref));
-            } else if constexpr(when == Stage::PreTick) {
-                m_states.at(s).pretick.push_back(new ClassSystem<Clazz, Function>(ref));
-            }
-        }
+    template<class Clazz, void(Clazz::*Function)(float, ::Arclight::World&), Stage when = Stage::Tick, State s = StateNone, typename... Access>
+    ALWAYS_INLINE Application& add_system(Clazz& ref, Access... access) {
+        system_stage<when, s>().add(std::make_unique<ClassSystem<Clazz, Function>>(ref), SystemAccess::from(access...));
 
         return *this;
     }
@@ -146,7 +148,10 @@ private:
 
     void run_state_init_systems();
     void run_state_exit_systems();
-    void process_job_queue();
+    friend void resume_task(Job& job);
+
+    void process_job_queue(Stage stage);
+    void add_stage_waiter(Stage stage, Job& job);
     void process_defer_queue();
 
     void load_state_impl(State s);
@@ -155,36 +160,55 @@ private:
     void load_world_impl(std::shared_ptr<World> world);
 
     void init_system_group(SystemGroup& g) {
-        for (auto& sys : g.pretick) {
-            sys->Init();
-        }
+        g.pretick.init_systems();
+        g.tick.init_systems();
+        g.posttick.init_systems();
+    }
 
-        for (auto& sys : g.tick) {
-            sys->Init();
+    template<Stage when, State s>
+    SystemStage& system_stage() {
+        SystemGroup* group;
+        if constexpr(s == StateNone) {
+            group = &m_globalSystems;
+        } else {
+            group = &m_states.at(s);
         }
 
-        for (auto& sys : g.posttick) {
-            sys->Init();
+        if constexpr(when == Stage::Init) {
+            return group->init;
+        } else if constexpr(when == Stage::Exit) {
+            return group->exit;
+        } else if constexpr(when == Stage::PreTick) {
+            return group->pretick;
+        } else if constexpr(when == Stage::Tick) {
+            return group->tick;
+        } else {
+            static_assert(when == Stage::PostTick);
+            return group->posttick;
         }
     }
 
     template<Stage stage>
-    void queue_system_group(SystemGroup& g) {
+    ALWAYS_INLINE static SystemStage& group_stage(SystemGroup& g) {
         if constexpr(stage == Stage::PreTick) {
-            for (auto* sys : g.pretick) {
-                m_threadPool.Schedule(*sys);
-            }
+            return g.pretick;
         } else if constexpr(stage == Stage::Tick) {
-            for (auto* sys : g.tick) {
-                m_threadPool.Schedule(*sys);
-            }
-        } else if constexpr(stage == Stage::PostTick) {
-            for (auto* sys : g.posttick) {
-                m_threadPool.Schedule(*sys);
-            }
+            return g.tick;
+        } else {
+            static_assert(stage == Stage::PostTick);
+            return g.posttick;
         }
     }
 
+    // Global and current state systems are scheduled as one graph,
+    // state systems are ordered after the global systems they conflict with
+    template<Stage stage>
+    void queue_systems() {
+        group_stage<stage>(m_globalSystems)
+            .schedule(m_threadPool,
+                      m_currentState ? &group_stage<stage>(*m_currentState) : nullptr);
+    }
+
     // Frame delay in us
     const long m_frameDelay = 1000000 / 120;
 
@@ -192,6 +216,15 @@ private:
 
     Timer m_timer;
 
+    // Indexed by Stage
+    std::array<long, static_cast<size_t>(Stage::StageCount)> m_stageWaitTimes = {};
+
+    // Suspended tasks waiting for a stage, indexed by Stage
+    std::array<std::vector<Job*>, static_cast<size_t>(Stage::StageCount)> m_stageWaiters;
+    // Suspended tasks waiting for whichever stage finishes first
+    std::vector<Job*> m_resumedTasks;
+    std::mutex m_stageWaitersLock;
+
     Input m_input;
     ThreadPool m_threadPool;
     ResourceManager m_resourceManager;
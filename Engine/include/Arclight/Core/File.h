@@ -21,6 +21,8 @@ public:
     // It's important we use UnicodeString here,
     // as some platforms like Windows use UTF-16 for filenames.
     static bool Access(const UnicodeString& path, int mode = OpenReadOnly);
+    // Unlike Access, does not log anything when the file is missing
+    static bool Exists(const UnicodeString& path);
     static File* Open(const UnicodeString& path, int flags = OpenReadOnly, Error* error = nullptr);
 
     virtual bool IsOpen() const = 0;
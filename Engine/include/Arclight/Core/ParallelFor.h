@@ -0,0 +1,77 @@
+#pragma once
+
+#include <Arclight/Core/Job.h>
+#include <Arclight/Core/ThreadPool.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace Arclight {
+
+// Runs Function over a subrange of a parallel_for
+template <typename Function> class RangeJob final : public Job {
+public:
+    RangeJob(Function& function, size_t begin, size_t end,
+             const std::shared_ptr<std::atomic<unsigned>>& remaining)
+        : m_function(function), m_begin(begin), m_end(end), m_remaining(remaining) {}
+
+    void run() override {
+        m_function(m_begin, m_end);
+
+        // Once the count reaches zero parallel_for may return and destroy this job,
+        // the counter is kept alive by the local reference until it has been notified
+        std::shared_ptr<std::atomic<unsigned>> remaining = m_remaining;
+        if (remaining->fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            remaining->notify_all();
+        }
+    }
+
+private:
+    Function& m_function;
+    size_t m_begin;
+    size_t m_end;
+    std::shared_ptr<std::atomic<unsigned>> m_remaining;
+};
+
+////////////////////////////////////////
+/// \brief Split [0, count) into chunks and run them on the ThreadPool
+///
+/// Function is called as function(begin, end) for each chunk.
+/// The calling thread runs the first chunk itself then helps
+/// with queued jobs until every chunk has finished.
+///
+/// \param count Size of the range
+/// \param grainSize Maximum number of elements per chunk
+/// \param function Function to call for each chunk
+////////////////////////////////////////
+template <typename Function>
+void parallel_for(size_t count, size_t grainSize, Function&& function) {
+    grainSize = std::max<size_t>(grainSize, 1);
+
+    ThreadPool* pool = ThreadPool::instance();
+    if (!pool || !pool->thread_count() || count <= grainSize) {
+        function(size_t(0), count);
+        return;
+    }
+
+    const size_t chunkCount = (count + grainSize - 1) / grainSize;
+    auto remaining =
+        std::make_shared<std::atomic<unsigned>>(static_cast<unsigned>(chunkCount - 1));
+
+    std::vector<RangeJob<Function>> jobs;
+    jobs.reserve(chunkCount - 1);
+    for (size_t i = 1; i < chunkCount; i++) {
+        jobs.emplace_back(function, i * grainSize, std::min(count, (i + 1) * grainSize),
+                          remaining);
+        pool->Schedule(jobs.back());
+    }
+
+    function(size_t(0), grainSize);
+
+    pool->wait_for(*remaining);
+}
+
+} // namespace Arclight
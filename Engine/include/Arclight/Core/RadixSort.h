@@ -0,0 +1,101 @@
+#pragma once
+
+#include <Arclight/Core/ParallelFor.h>
+#include <Arclight/Core/ThreadPool.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <vector>
+
+// Below this many items radix sort is not worth it
+#define RADIXSORT_MIN_ITEMS 256
+// Minimum items per job
+#define RADIXSORT_GRAIN_SIZE 4096
+
+namespace Arclight {
+
+////////////////////////////////////////
+/// \brief Stable LSD radix sort by a 64-bit key
+///
+/// Sorts 8 bits at a time, passes where every key has the same digit are skipped.
+/// Each pass counts and scatters in parallel on the ThreadPool,
+/// every job owns a contiguous range of items so the sort stays stable.
+///
+/// \param items Items to sort
+/// \param scratch Temporary storage, resized to the size of items.
+/// Pass the same vector every time to avoid reallocating.
+/// \param key Function returning the uint64_t key of an item
+////////////////////////////////////////
+template <typename T, typename KeyFunction>
+void parallel_radix_sort(std::vector<T>& items, std::vector<T>& scratch, KeyFunction&& key) {
+    const size_t count = items.size();
+    if (count < RADIXSORT_MIN_ITEMS) {
+        std::stable_sort(items.begin(), items.end(),
+                         [&](const T& l, const T& r) { return key(l) < key(r); });
+        return;
+    }
+
+    ThreadPool* pool = ThreadPool::instance();
+    const size_t threadCount = pool ? pool->thread_count() + 1 : 1;
+
+    const size_t jobCount =
+        std::clamp<size_t>(count / RADIXSORT_GRAIN_SIZE, 1, threadCount);
+    const size_t grainSize = (count + jobCount - 1) / jobCount;
+
+    using Histogram = std::array<uint32_t, 256>;
+    std::vector<Histogram> histograms(jobCount);
+
+    scratch.resize(count);
+    T* in = items.data();
+    T* out = scratch.data();
+
+    for (unsigned shift = 0; shift < 64; shift += 8) {
+        parallel_for(count, grainSize, [&](size_t begin, size_t end) {
+            Histogram& histogram = histograms[begin / grainSize];
+            histogram.fill(0);
+
+            for (size_t i = begin; i < end; i++) {
+                histogram[(key(in[i]) >> shift) & 0xff]++;
+            }
+        });
+
+        // Turn the counts into the offset each job starts writing each digit at,
+        // digit by digit then job by job
+        uint32_t offset = 0;
+        bool trivial = false;
+        for (unsigned digit = 0; digit < 256; digit++) {
+            uint32_t digitStart = offset;
+            for (Histogram& histogram : histograms) {
+                uint32_t digitCount = histogram[digit];
+                histogram[digit] = offset;
+                offset += digitCount;
+            }
+
+            if (offset - digitStart == count) {
+                trivial = true;
+            }
+        }
+
+        // Every key has the same digit, the pass would not move anything
+        if (trivial) {
+            continue;
+        }
+
+        parallel_for(count, grainSize, [&](size_t begin, size_t end) {
+            Histogram& histogram = histograms[begin / grainSize];
+
+            for (size_t i = begin; i < end; i++) {
+                out[histogram[(key(in[i]) >> shift) & 0xff]++] = in[i];
+            }
+        });
+
+        std::swap(in, out);
+    }
+
+    if (in != items.data()) {
+        items.swap(scratch);
+    }
+}
+
+} // namespace Arclight
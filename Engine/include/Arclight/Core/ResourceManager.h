@@ -1,10 +1,15 @@
 #pragma once
 
 #include <cassert>
+#include <condition_variable>
+#include <coroutine>
+#include <functional>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <queue>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include <Arclight/Core/Resource.h>
@@ -38,9 +43,74 @@ public:
         return std::move(ObjectCast<R>(get_resource(id)));
     }
 
+    using LoadCallback = std::function<void(std::shared_ptr<Resource>)>;
+
+    ////////////////////////////////////////
+    /// \brief Load a resource on the loader thread
+    ///
+    /// The callback is called on the loader thread once the resource is loaded,
+    /// with nullptr if the resource could not be found.
+    ////////////////////////////////////////
+    void load_async(const std::string& id, LoadCallback callback);
+
+    template<typename R>
+    class LoadAwaiter {
+    public:
+        LoadAwaiter(ResourceManager& manager, std::string id) : m_manager(manager), m_id(std::move(id)) {}
+
+        bool await_ready() const noexcept { return false; }
+
+        // The task no longer occupies a worker while the resource loads,
+        // the loader thread queues it to resume after the current stage
+        template<typename P>
+        void await_suspend(std::coroutine_handle<P> handle) {
+            m_manager.load_async(m_id, [this, handle](std::shared_ptr<Resource> resource) {
+                m_resource = std::move(resource);
+                handle.promise().schedule();
+            });
+        }
+
+        std::shared_ptr<R> await_resume() {
+            if (!m_resource) {
+                return nullptr;
+            }
+
+            return ObjectCast<R>(m_resource);
+        }
+
+    private:
+        ResourceManager& m_manager;
+        std::string m_id;
+        std::shared_ptr<Resource> m_resource;
+    };
+
+    ////////////////////////////////////////
+    /// \brief Await a resource load from a Task
+    ///
+    /// auto image = co_await ResourceManager::instance().load_async<Image>("assets/ball.png");
+    ////////////////////////////////////////
+    template<typename R>
+    inline LoadAwaiter<R> load_async(const std::string& id) {
+        return LoadAwaiter<R>(*this, id);
+    }
+
 private:
+    struct PendingLoad {
+        std::string id;
+        LoadCallback callback;
+    };
+
+    void loader_main();
+
     static ResourceManager* s_instance;
 
+    // Started on the first asynchronous load
+    std::thread m_loaderThread;
+    std::queue<PendingLoad> m_pendingLoads;
+    std::condition_variable m_loaderCondition;
+    std::mutex m_loaderLock;
+    bool m_loaderShouldDie = false;
+
     std::vector<ResourceFormat*> m_formats;
     std::map<std::string, std::shared_ptr<Resource>> m_resources;
     std::mutex m_lock;
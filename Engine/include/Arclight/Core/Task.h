@@ -0,0 +1,220 @@
+#pragma once
+
+#include <Arclight/Core/Job.h>
+#include <Arclight/Core/Util.h>
+#include <Arclight/Platform/API.h>
+
+#include <cassert>
+#include <coroutine>
+#include <cstdlib>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace Arclight {
+
+template <typename T = void> class Task;
+
+// Resumes a suspended coroutine
+class CoroutineJob final : public Job {
+public:
+    ALWAYS_INLINE void set_handle(std::coroutine_handle<> handle) { m_handle = handle; }
+
+    void run() override {
+        // The coroutine frame (and this job) may be destroyed by resume()
+        m_handle.resume();
+    }
+
+private:
+    std::coroutine_handle<> m_handle;
+};
+
+////////////////////////////////////////
+/// \brief Queue the resume job of a suspended task
+///
+/// Implemented by Application, the task is resumed on the main thread
+/// once the systems of the current stage have finished.
+////////////////////////////////////////
+ARCLIGHT_API void resume_task(Job& job);
+
+////////////////////////////////////////
+/// \brief State shared by all Task promises
+///
+/// Awaitables resume a task by queueing its resume job with resume_task(),
+/// a task is only ever suspended in one place so one job per task is enough.
+////////////////////////////////////////
+class TaskPromiseBase {
+public:
+    struct FinalAwaiter {
+        bool await_ready() noexcept { return false; }
+
+        template <typename P>
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<P> handle) noexcept {
+            TaskPromiseBase& promise = handle.promise();
+            if (promise.m_continuation) {
+                return promise.m_continuation;
+            }
+
+            // Nobody owns a detached task, clean up after ourselves
+            if (promise.m_detached) {
+                handle.destroy();
+            }
+
+            return std::noop_coroutine();
+        }
+
+        void await_resume() noexcept {}
+    };
+
+    std::suspend_always initial_suspend() noexcept { return {}; }
+    FinalAwaiter final_suspend() noexcept { return {}; }
+
+    // Exceptions are disabled
+    void unhandled_exception() noexcept { std::abort(); }
+
+    ALWAYS_INLINE CoroutineJob& resume_job() { return m_resumeJob; }
+
+    ////////////////////////////////////////
+    /// \brief Resume the task once the systems of the current stage have finished
+    ////////////////////////////////////////
+    ALWAYS_INLINE void schedule() { resume_task(m_resumeJob); }
+
+protected:
+    template <typename T> friend class Task;
+    friend void spawn(Task<void>&& task);
+
+    CoroutineJob m_resumeJob;
+    std::coroutine_handle<> m_continuation;
+    bool m_detached = false;
+};
+
+template <typename T> class TaskPromise final : public TaskPromiseBase {
+public:
+    Task<T> get_return_object();
+
+    template <typename U> void return_value(U&& value) { m_value.emplace(std::forward<U>(value)); }
+
+    ALWAYS_INLINE T& result() { return *m_value; }
+
+private:
+    std::optional<T> m_value;
+};
+
+template <> class TaskPromise<void> final : public TaskPromiseBase {
+public:
+    Task<void> get_return_object();
+
+    void return_void() {}
+
+    ALWAYS_INLINE void result() {}
+};
+
+////////////////////////////////////////
+/// \brief Coroutine resumed on the main thread between stages
+///
+/// Tasks start suspended. They are started either by another task awaiting them,
+/// or detached with spawn().
+/// While suspended a task does not occupy a worker thread.
+/// Tasks are only resumed once the systems of a stage have finished, one at a time,
+/// so they may access the World like a system which declares no access.
+///
+/// Tasks can co_await:
+///     - Other tasks (co_await load_level();)
+///     - Resource loads (co_await ResourceManager::instance().load_async<Image>("a.png");)
+///     - Frame stages (co_await Application::instance().next_stage(Application::Stage::Tick);)
+///     - The end of the current stage (co_await yield();)
+////////////////////////////////////////
+template <typename T> class Task final {
+public:
+    using promise_type = TaskPromise<T>;
+
+    Task() = default;
+    explicit Task(std::coroutine_handle<promise_type> handle) : m_handle(handle) {}
+
+    Task(Task&& other) : m_handle(std::exchange(other.m_handle, nullptr)) {}
+    Task& operator=(Task&& other) {
+        if (this != &other) {
+            if (m_handle) {
+                m_handle.destroy();
+            }
+
+            m_handle = std::exchange(other.m_handle, nullptr);
+        }
+
+        return *this;
+    }
+
+    Task(const Task&) = delete;
+    Task& operator=(const Task&) = delete;
+
+    ~Task() {
+        if (m_handle) {
+            m_handle.destroy();
+        }
+    }
+
+    ALWAYS_INLINE bool valid() const { return static_cast<bool>(m_handle); }
+    ALWAYS_INLINE bool done() const { return m_handle && m_handle.done(); }
+
+    // Start the task inline and resume the awaiting coroutine once it finishes
+    bool await_ready() const noexcept { return !m_handle || m_handle.done(); }
+
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept {
+        m_handle.promise().m_continuation = awaiting;
+        return m_handle;
+    }
+
+    T await_resume() {
+        if constexpr (!std::is_void_v<T>) {
+            return std::move(m_handle.promise().result());
+        }
+    }
+
+private:
+    friend void spawn(Task<void>&& task);
+
+    std::coroutine_handle<promise_type> m_handle;
+};
+
+template <typename T> Task<T> TaskPromise<T>::get_return_object() {
+    auto handle = std::coroutine_handle<TaskPromise<T>>::from_promise(*this);
+    m_resumeJob.set_handle(handle);
+    return Task<T>(handle);
+}
+
+inline Task<void> TaskPromise<void>::get_return_object() {
+    auto handle = std::coroutine_handle<TaskPromise<void>>::from_promise(*this);
+    m_resumeJob.set_handle(handle);
+    return Task<void>(handle);
+}
+
+////////////////////////////////////////
+/// \brief Start a task without waiting for it
+///
+/// The task is started once the systems of the current stage have finished.
+/// The task frame is destroyed when it finishes.
+////////////////////////////////////////
+inline void spawn(Task<void>&& task) {
+    assert(task.valid());
+
+    auto handle = std::exchange(task.m_handle, nullptr);
+    handle.promise().m_detached = true;
+    handle.promise().schedule();
+}
+
+////////////////////////////////////////
+/// \brief Suspend the current task until the end of the current stage
+///
+/// Lets a long running task spread its work over several stages.
+////////////////////////////////////////
+struct yield {
+    bool await_ready() const noexcept { return false; }
+
+    template <typename P> void await_suspend(std::coroutine_handle<P> handle) {
+        handle.promise().schedule();
+    }
+
+    void await_resume() const noexcept {}
+};
+
+} // namespace Arclight
@@ -1,18 +1,27 @@
 #pragma once
 
 #include <Arclight/Core/Job.h>
+#include <Arclight/Core/WorkStealingQueue.h>
 
 #include <thread>
 #include <vector>
 #include <mutex>
 #include <atomic>
 #include <queue>
-#include <condition_variable>
+#include <memory>
 
 namespace Arclight {
 
+////////////////////////////////////////
+/// \brief Work stealing ThreadPool
+///
+/// Every worker thread (and the thread which created the pool)
+/// owns a lock-free deque. Jobs scheduled from a pool thread
+/// are pushed to its own deque, idle threads steal from the others.
+/// Jobs scheduled from foreign threads go through a small locked injection queue.
+////////////////////////////////////////
 class ThreadPool final {
-    friend void ThreadMain(ThreadPool* pool);
+    friend void ThreadMain(ThreadPool* pool, int index);
 public:
     ThreadPool();
     ~ThreadPool();
@@ -21,9 +30,34 @@ public:
 
     ////////////////////////////////////////
 	/// \brief Execute ThreadPool job queue until it is exhausted
+    ///
+    /// The calling thread participates in running jobs,
+    /// stealing from workers when its own deque is empty.
     ////////////////////////////////////////
     void run();
 
+    ////////////////////////////////////////
+	/// \brief Wait for every scheduled job to finish
+    ///
+    /// The calling thread executes jobs while any are queued,
+    /// then sleeps until the last running job signals completion.
+    ///
+    /// \return Time in microseconds spent blocked
+    ////////////////////////////////////////
+    long wait_idle();
+
+    ////////////////////////////////////////
+	/// \brief Wait for a counter of child jobs to reach zero
+    ///
+    /// Intended for jobs waiting on jobs they scheduled.
+    /// The calling thread executes queued jobs while waiting,
+    /// then sleeps on the counter once there is nothing left to run.
+    /// Child jobs must decrement the counter and notify it when it reaches zero.
+    /// The waiter may return as soon as the counter is zero,
+    /// so the counter has to outlive the last notify (e.g. shared with the children).
+    ////////////////////////////////////////
+    void wait_for(std::atomic<unsigned>& counter);
+
     ////////////////////////////////////////
 	/// \brief Check if ThreadPool is idle.
     ///
@@ -35,21 +69,41 @@ public:
     bool Idle() const;
 
     unsigned thread_count() const { return m_threads.size(); }
-    unsigned job_count() const { return m_jobCount; }
+    unsigned job_count() const { return m_jobCount.load(std::memory_order_acquire); }
 
     inline static ThreadPool* instance() { return m_instance; }
 
 private:
+    // Find a job for the thread with deque index, -1 if the thread has no deque
+    Job* find_job(int index);
+    Job* steal_job(int index);
+    void execute(Job* job);
+
     static ThreadPool* m_instance;
+    // Deque index of the current thread, -1 when not owned by the pool
+    static thread_local int s_threadIndex;
 
-    bool m_threadsShouldDie = false;
+    std::atomic<bool> m_threadsShouldDie = false;
 
     std::vector<std::thread> m_threads; // Thread objects
+    // One deque per worker, the last is owned by the thread which created the pool
+    std::vector<std::unique_ptr<WorkStealingQueue<Job*>>> m_queues;
 
     std::atomic<unsigned> m_jobCount = 0; // Total amount of jobs (running and queued)
-    std::queue<Job*> m_jobs; // FIFO Job Queue
-    std::condition_variable m_condition; // Used to wait for available jobs
-    std::mutex m_queueMutex; // Queue Mutex
+
+    // Jobs scheduled by threads without a deque
+    std::queue<Job*> m_injectedJobs;
+    std::atomic<unsigned> m_injectedCount = 0;
+    std::mutex m_injectedMutex;
+
+    // Idle workers sleep on the epoch, it is bumped when a job is scheduled
+    std::atomic<uint32_t> m_wakeEpoch = 0;
+    std::atomic<unsigned> m_sleepingThreads = 0;
+
+    // Threads in wait_idle() sleep on the epoch,
+    // it is bumped when the job count reaches zero or a job is scheduled
+    std::atomic<uint32_t> m_idleEpoch = 0;
+    std::atomic<unsigned> m_idleWaiters = 0;
 };
 
 } // namespace Arclight
@@ -0,0 +1,159 @@
+#pragma once
+
+#include <Arclight/Core/Util.h>
+
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace Arclight {
+
+////////////////////////////////////////
+/// \brief Lock-free Chase-Lev work stealing deque
+///
+/// The owning thread pushes and pops from the bottom (LIFO),
+/// any other thread may steal from the top (FIFO).
+/// Based on 'Correct and Efficient Work-Stealing for Weak Memory Models' (Le et al. 2013).
+///
+/// Only the owner may call push() and pop(), steal() is safe from any thread.
+////////////////////////////////////////
+template <typename T> class WorkStealingQueue final {
+    static_assert(std::is_pointer_v<T>, "WorkStealingQueue stores pointers");
+
+    struct Buffer {
+        explicit Buffer(int64_t capacity)
+            : capacity(capacity), mask(capacity - 1), items(new std::atomic<T>[capacity]) {
+            assert((capacity & mask) == 0); // Must be a power of two
+        }
+
+        ALWAYS_INLINE T get(int64_t index) const {
+            return items[index & mask].load(std::memory_order_relaxed);
+        }
+
+        ALWAYS_INLINE void put(int64_t index, T item) {
+            items[index & mask].store(item, std::memory_order_relaxed);
+        }
+
+        const int64_t capacity;
+        const int64_t mask;
+        std::unique_ptr<std::atomic<T>[]> items;
+    };
+
+public:
+    explicit WorkStealingQueue(int64_t capacity = 256) {
+        m_retired.push_back(std::make_unique<Buffer>(capacity));
+        m_buffer.store(m_retired.back().get(), std::memory_order_relaxed);
+    }
+
+    WorkStealingQueue(const WorkStealingQueue&) = delete;
+    WorkStealingQueue& operator=(const WorkStealingQueue&) = delete;
+
+    ////////////////////////////////////////
+    /// \brief Push an item onto the bottom of the deque. Owner only.
+    ////////////////////////////////////////
+    void push(T item) {
+        int64_t bottom = m_bottom.load(std::memory_order_relaxed);
+        int64_t top = m_top.load(std::memory_order_acquire);
+        Buffer* buffer = m_buffer.load(std::memory_order_relaxed);
+
+        if (bottom - top > buffer->capacity - 1) {
+            buffer = grow(buffer, bottom, top);
+        }
+
+        buffer->put(bottom, item);
+        std::atomic_thread_fence(std::memory_order_release);
+        m_bottom.store(bottom + 1, std::memory_order_relaxed);
+    }
+
+    ////////////////////////////////////////
+    /// \brief Pop an item from the bottom of the deque. Owner only.
+    ///
+    /// \return Item or nullptr if the deque is empty
+    ////////////////////////////////////////
+    T pop() {
+        int64_t bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+        Buffer* buffer = m_buffer.load(std::memory_order_relaxed);
+        m_bottom.store(bottom, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t top = m_top.load(std::memory_order_relaxed);
+
+        if (top > bottom) {
+            // Empty
+            m_bottom.store(bottom + 1, std::memory_order_relaxed);
+            return nullptr;
+        }
+
+        T item = buffer->get(bottom);
+        if (top == bottom) {
+            // Last item, race against stealers
+            if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                               std::memory_order_relaxed)) {
+                item = nullptr;
+            }
+            m_bottom.store(bottom + 1, std::memory_order_relaxed);
+        }
+
+        return item;
+    }
+
+    ////////////////////////////////////////
+    /// \brief Steal an item from the top of the deque.
+    ///
+    /// \return Item or nullptr if the deque is empty or the steal lost a race
+    ////////////////////////////////////////
+    T steal() {
+        int64_t top = m_top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t bottom = m_bottom.load(std::memory_order_acquire);
+
+        if (top >= bottom) {
+            return nullptr;
+        }
+
+        // Buffers are only freed on destruction so this is safe to read after a grow
+        Buffer* buffer = m_buffer.load(std::memory_order_acquire);
+        T item = buffer->get(top);
+        if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                           std::memory_order_relaxed)) {
+            return nullptr;
+        }
+
+        return item;
+    }
+
+    ////////////////////////////////////////
+    /// \brief Approximate number of items in the deque
+    ////////////////////////////////////////
+    int64_t size() const {
+        int64_t bottom = m_bottom.load(std::memory_order_relaxed);
+        int64_t top = m_top.load(std::memory_order_relaxed);
+        return bottom > top ? bottom - top : 0;
+    }
+
+    bool empty() const { return size() == 0; }
+
+private:
+    Buffer* grow(Buffer* old, int64_t bottom, int64_t top) {
+        auto buffer = std::make_unique<Buffer>(old->capacity * 2);
+        for (int64_t i = top; i < bottom; i++) {
+            buffer->put(i, old->get(i));
+        }
+
+        // Stealers may still be reading the old buffer, keep it alive until destruction
+        m_retired.push_back(std::move(buffer));
+        m_buffer.store(m_retired.back().get(), std::memory_order_release);
+        return m_retired.back().get();
+    }
+
+    // Keep top and bottom on separate cache lines, stealers hammer top
+    alignas(64) std::atomic<int64_t> m_top = 0;
+    alignas(64) std::atomic<int64_t> m_bottom = 0;
+    alignas(64) std::atomic<Buffer*> m_buffer;
+
+    std::vector<std::unique_ptr<Buffer>> m_retired; // Owner only
+};
+
+} // namespace Arclight
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <Arclight/Core/Util.h>
+#include <Arclight/ECS/Entity.h>
+
+#include <entt/core/type_info.hpp>
+
+#include <algorithm>
+#include <vector>
+
+namespace Arclight {
+
+////////////////////////////////////////
+/// \brief Declare components a system reads
+///
+/// Passed to Application::add_system, e.g.
+/// app.add_system<move_balls>(Reads<Velocity>(), Writes<Transform2D>());
+////////////////////////////////////////
+template <typename... C> struct Reads {};
+
+////////////////////////////////////////
+/// \brief Declare components a system writes (implies read)
+///
+/// Systems which create or destroy entities should declare Writes<Entity>.
+////////////////////////////////////////
+template <typename... C> struct Writes {};
+
+////////////////////////////////////////
+/// \brief Set of component types a system accesses
+///
+/// Systems which do not declare any access are exclusive,
+/// they conflict with every other system in the stage.
+////////////////////////////////////////
+class SystemAccess final {
+public:
+    template <typename... Access> static SystemAccess from(Access... access) {
+        SystemAccess result;
+        (result.declare(access), ...);
+        return result;
+    }
+
+    ////////////////////////////////////////
+    /// \brief Check if two systems cannot run concurrently
+    ///
+    /// \return True when either is exclusive or one writes a component the other accesses
+    ////////////////////////////////////////
+    bool conflicts(const SystemAccess& other) const {
+        if (m_exclusive || other.m_exclusive) {
+            return true;
+        }
+
+        for (entt::id_type type : m_writes) {
+            if (other.reads(type) || other.writes(type)) {
+                return true;
+            }
+        }
+
+        for (entt::id_type type : other.m_writes) {
+            if (reads(type)) {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    ALWAYS_INLINE bool exclusive() const { return m_exclusive; }
+
+private:
+    template <typename... C> void declare(Reads<C...>) {
+        (m_reads.push_back(entt::type_id<C>().hash()), ...);
+        m_exclusive = false;
+    }
+
+    template <typename... C> void declare(Writes<C...>) {
+        (m_writes.push_back(entt::type_id<C>().hash()), ...);
+        m_exclusive = false;
+    }
+
+    ALWAYS_INLINE bool reads(entt::id_type type) const {
+        return std::find(m_reads.begin(), m_reads.end(), type) != m_reads.end();
+    }
+
+    ALWAYS_INLINE bool writes(entt::id_type type) const {
+        return std::find(m_writes.begin(), m_writes.end(), type) != m_writes.end();
+    }
+
+    std::vector<entt::id_type> m_reads;
+    std::vector<entt::id_type> m_writes;
+
+    bool m_exclusive = true;
+};
+
+} // namespace Arclight
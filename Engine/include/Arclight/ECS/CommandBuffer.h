@@ -0,0 +1,155 @@
+#pragma once
+
+#include <Arclight/Core/NonCopyable.h>
+#include <Arclight/Core/Util.h>
+#include <Arclight/ECS/Component.h>
+#include <Arclight/ECS/Entity.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace Arclight {
+
+class World;
+class CommandBuffer;
+
+////////////////////////////////////////
+/// \brief Entity created by a CommandBuffer which does not exist yet
+///
+/// Can only be used as the target of further commands,
+/// it becomes a real entity when the command buffers are replayed.
+////////////////////////////////////////
+struct PendingEntity {
+    CommandBuffer* buffer;
+    uint32_t index;
+};
+
+////////////////////////////////////////
+/// \brief Deferred structural changes recorded by a single thread
+///
+/// Each thread records into its own buffer without locking (see World::commands()).
+/// Buffers are replayed by World::cleanup() at the end of the stage.
+///
+/// Commands are replayed grouped by the system which recorded them,
+/// in the order the systems were added, then in the order they were recorded.
+/// Commands recorded outside of systems are replayed first.
+////////////////////////////////////////
+class CommandBuffer final : NonCopyable {
+    friend class World;
+
+public:
+    CommandBuffer() = default;
+    ~CommandBuffer();
+
+    PendingEntity create();
+
+    void destroy(Entity entity);
+
+    template <Component C, typename... Args> void emplace(Entity entity, Args&&... args) {
+        record_emplace<C>(Target{entity, nullptr, 0}, std::forward<Args>(args)...);
+    }
+
+    template <Component C, typename... Args> void emplace(PendingEntity entity, Args&&... args) {
+        record_emplace<C>(Target{NullEntity, entity.buffer, entity.index},
+                          std::forward<Args>(args)...);
+    }
+
+    template <Component... C> void remove(Entity entity) {
+        (push(Op::Remove, Target{entity, nullptr, 0}, &apply_remove<C>, nullptr, nullptr), ...);
+    }
+
+    ALWAYS_INLINE bool empty() const { return m_commands.empty(); }
+
+    ////////////////////////////////////////
+    /// \brief Identifies who is recording commands on the current thread
+    ///
+    /// Set by systems as they run so replay order does not depend on
+    /// which thread ran which system. Upper 32 bits are the system,
+    /// lower 32 bits the chunk of a World::parallel_each.
+    ////////////////////////////////////////
+    class SourceScope final {
+    public:
+        explicit SourceScope(uint64_t source) : m_previous(s_source) { s_source = source; }
+        ~SourceScope() { s_source = m_previous; }
+
+    private:
+        uint64_t m_previous;
+    };
+
+    ALWAYS_INLINE static uint64_t current_source() { return s_source; }
+
+private:
+    enum class Op : uint8_t {
+        Create,
+        Destroy,
+        Emplace,
+        Remove,
+    };
+
+    struct Target {
+        Entity entity;
+        CommandBuffer* buffer; // Set when the target is a PendingEntity
+        uint32_t pending;
+    };
+
+    struct Command {
+        uint64_t source;
+        uint32_t sequence;
+        Op op;
+        Target target;
+
+        void (*apply)(World&, Entity, void*);
+        void (*destroy)(void*); // Destroys the payload without applying it
+        void* payload;
+    };
+
+    // Payloads are stored in blocks which are kept between frames
+    struct Block {
+        std::unique_ptr<std::byte[]> data;
+        size_t size;
+        size_t used;
+    };
+
+    template <Component C, typename... Args> void record_emplace(Target target, Args&&... args) {
+        void* payload = allocate(sizeof(C), alignof(C));
+        new (payload) C{std::forward<Args>(args)...};
+
+        push(Op::Emplace, target, &apply_emplace<C>, &destroy_payload<C>, payload);
+    }
+
+    template <Component C> static void apply_emplace(World& world, Entity entity, void* payload);
+    template <Component C> static void apply_remove(World& world, Entity entity, void* payload);
+
+    template <Component C> static void destroy_payload(void* payload) {
+        static_cast<C*>(payload)->~C();
+    }
+
+    ALWAYS_INLINE void push(Op op, Target target, void (*apply)(World&, Entity, void*) = nullptr,
+                            void (*destroy)(void*) = nullptr, void* payload = nullptr) {
+        // A buffer is shared by everything running on its thread, tag each command
+        m_commands.push_back({s_source, m_sequence++, op, target, apply, destroy, payload});
+    }
+
+    void* allocate(size_t size, size_t alignment);
+
+    // Drop all commands, keeps allocated memory
+    void reset();
+
+    static thread_local uint64_t s_source;
+
+    uint32_t m_sequence = 0;
+    std::vector<Command> m_commands;
+
+    // Entities created during replay, indexed by PendingEntity::index
+    std::vector<Entity> m_created;
+    uint32_t m_pendingCount = 0;
+
+    std::vector<Block> m_blocks;
+    size_t m_currentBlock = 0;
+};
+
+} // namespace Arclight
@@ -1,25 +1,90 @@
 #pragma once
 
-#include <list>
+#include <atomic>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include <Arclight/Core/Job.h>
 #include <Arclight/Core/NonCopyable.h>
 #include <Arclight/Core/Object.h>
 #include <Arclight/Core/Timer.h>
 #include <Arclight/Core/Util.h>
+#include <Arclight/ECS/Access.h>
 #include <Arclight/ECS/World.h>
 
 namespace Arclight {
 
+class ThreadPool;
+
+////////////////////////////////////////
+/// \brief Systems run in one stage and the order they must run in
+///
+/// Systems are ordered by their declared access (see Arclight/ECS/Access.h).
+/// A system depends on every earlier added system it conflicts with,
+/// systems which do not conflict run concurrently.
+////////////////////////////////////////
+class SystemStage final : NonCopyable {
+public:
+    SystemStage() = default;
+    SystemStage(SystemStage&&) = default;
+
+    void add(std::unique_ptr<Job> system, SystemAccess access);
+
+    ////////////////////////////////////////
+    /// \brief Schedule the stage on the ThreadPool
+    ///
+    /// Systems without dependencies are scheduled immediately,
+    /// the rest are scheduled by the last system they depend on.
+    ///
+    /// \param next Stage scheduled in the same graph,
+    /// as if its systems had been added to this stage after the systems of this stage
+    ////////////////////////////////////////
+    void schedule(ThreadPool& pool, SystemStage* next = nullptr);
+
+    // Reset system timers
+    void init_systems();
+
+    ALWAYS_INLINE bool empty() const { return m_nodes.empty(); }
+
+private:
+    // Add dependencies from systems of this stage to conflicting systems of next
+    void link(SystemStage* next);
+
+    class Node final : public Job {
+    public:
+        void run() override;
+
+        std::unique_ptr<Job> system;
+        SystemAccess access;
+
+        // Identifies commands recorded by the system, see CommandBuffer::SourceScope
+        uint64_t source = 0;
+
+        ThreadPool* pool = nullptr;
+        std::vector<Node*> dependents;
+        unsigned dependencyCount = 0;
+        // Dependencies on the stage scheduled before this one, see link()
+        std::vector<Node*> linkedDependents;
+        unsigned linkedDependencyCount = 0;
+        std::atomic<unsigned> remaining = 0;
+    };
+
+    std::vector<std::unique_ptr<Node>> m_nodes;
+    std::vector<Node*> m_roots;
+
+    // Stage linked by the last schedule() and the node count of both when it was linked
+    SystemStage* m_next = nullptr;
+    size_t m_linkedNodeCount = 0;
+};
+
 struct SystemGroup {
-    std::list<Job*> init;
-    std::list<Job*> exit;
+    SystemStage init;
+    SystemStage exit;
     
-    std::list<Job*> pretick;
-    std::list<Job*> tick;
-    std::list<Job*> posttick;
+    SystemStage pretick;
+    SystemStage tick;
+    SystemStage posttick;
 };
 
 template <void (*Function)(float, World&)>
@@ -2,37 +2,54 @@
 
 #include <Arclight/Components/RemovalTag.h>
 #include <Arclight/Core/NonCopyable.h>
+#include <Arclight/Core/ParallelFor.h>
 #include <Arclight/Core/Util.h>
+#include <Arclight/ECS/CommandBuffer.h>
 #include <Arclight/ECS/Component.h>
 #include <Arclight/ECS/Entity.h>
 #include <Arclight/ECS/Registry.h>
 #include <Arclight/Platform/API.h>
 
+#include <memory>
 #include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
 
 namespace Arclight {
 
 class ARCLIGHT_API World final : NonCopyable {
     friend class Application;
+    friend class CommandBuffer;
 
 public:
-    World() = default;
+    World();
+    ~World();
 
     ALWAYS_INLINE static World& current() { return *s_currentWorld; }
 
     void cleanup();
 
+    ////////////////////////////////////////
+    /// \brief Create an entity immediately
+    ///
+    /// Modifies the registry directly, so it may only be called where nothing else
+    /// accesses the World: from systems which declare no access, from Tasks
+    /// and outside of a stage. Systems running alongside others use commands().create().
+    ////////////////////////////////////////
     ALWAYS_INLINE Entity create_entity() {
+        assert(!in_shared_scope());
         Entity ent = m_registry.create();
         return ent;
     }
 
-    ALWAYS_INLINE void destroy_entity(Entity entity) {
-        m_registry.emplace<Components::RemovalTag>(entity);
-    }
+    // Destruction is deferred until the end of the stage
+    ALWAYS_INLINE void destroy_entity(Entity entity) { commands().destroy(entity); }
 
+    // Same restrictions as create_entity(), otherwise use commands().emplace()
     template <Component C, typename... Args>
     ALWAYS_INLINE decltype(auto) add_component(Entity ent, Args&&... args) {
+        assert(!in_shared_scope());
         return m_registry.emplace<C>(ent, std::move(args)...);
     }
 
@@ -40,15 +57,39 @@ public:
         return m_registry.get<C>(ent);
     }
 
-    template <Component... C> ALWAYS_INLINE size_t remove_components(Entity ent) {
+    template <Component... C> ALWAYS_INLINE void remove_components(Entity ent) {
         // Check if valid ourselves as the removal is being deferred
         assert(m_registry.valid(ent));
-        // Needs to be deferred
-        std::unique_lock lock(m_componentCleanupMutex);
-        assure_cleanup_function<C...>();
-        m_registry.emplace<Components::ComponentRemovalTag<C>...>(ent);
+        commands().remove<C...>(ent);
     }
 
+    ////////////////////////////////////////
+    /// \brief Get the command buffer of the calling thread
+    ///
+    /// Structural changes (creating and destroying entities, adding and removing components)
+    /// recorded into the buffer are applied by cleanup() at the end of the stage.
+    /// Recording does not lock, every thread has its own buffer.
+    ////////////////////////////////////////
+    CommandBuffer& commands();
+
+    ////////////////////////////////////////
+    /// \brief Marks the calling thread as running alongside other systems
+    ///
+    /// Entered by systems which declare their access and by parallel_each chunks,
+    /// create_entity() and add_component() must not be called within one.
+    ////////////////////////////////////////
+    class ARCLIGHT_API SharedScope final {
+    public:
+        explicit SharedScope(bool shared = true);
+        ~SharedScope();
+
+    private:
+        bool m_previous;
+    };
+
+    // Whether the calling thread is within a SharedScope
+    static bool in_shared_scope();
+
     template <Component... C> ALWAYS_INLINE bool has_all_of(Entity ent) {
         return m_registry.all_of<C...>(ent);
     }
@@ -59,6 +100,47 @@ public:
 
     template <Component... C> ALWAYS_INLINE auto view() { return m_registry.view<C...>(); }
 
+    ////////////////////////////////////////
+    /// \brief Call a function for every entity with components C in parallel
+    ///
+    /// The view is split into chunks of grainSize entities which are run as jobs
+    /// on the ThreadPool. Returns once every chunk has been processed,
+    /// the calling thread runs jobs while it waits.
+    ///
+    /// Function is called as function(Entity, C&...) and may run on any thread,
+    /// it must not add or remove components C or create and destroy entities.
+    ///
+    /// \param function Function to call for each entity
+    /// \param grainSize Maximum number of entities per job
+    ////////////////////////////////////////
+    template <Component... C, typename Function>
+    void parallel_each(Function&& function, size_t grainSize = 1024) {
+        auto view = m_registry.view<C...>();
+        grainSize = std::max<size_t>(grainSize, 1);
+        // Commands recorded by each chunk are replayed in chunk order
+        const uint64_t source = CommandBuffer::current_source();
+
+        // Iterate the packed entity array of the smallest pool in the view
+        const auto& handle = view.handle();
+        const Entity* entities = handle.data();
+
+        parallel_for(handle.size(), grainSize, [&](size_t begin, size_t end) {
+            CommandBuffer::SourceScope scope(source | (begin / grainSize + 1));
+            SharedScope shared;
+
+            for (size_t i = begin; i < end; i++) {
+                const Entity entity = entities[i];
+                if constexpr (sizeof...(C) > 1) {
+                    if (!view.contains(entity)) {
+                        continue;
+                    }
+                }
+
+                function(entity, view.template get<C>(entity)...);
+            }
+        });
+    }
+
     ALWAYS_INLINE ECSRegistry& registry() { return m_registry; }
 
     template <typename T, typename... Args> ALWAYS_INLINE T& ctx_set(Args&&... args) {
@@ -90,10 +172,18 @@ private:
 
     // EnTT registry is not entirely thread-safe.
     // Arclight orders components into pools for cleanup.
-    // At the end of each frame,
+    // At the end of each stage,
     // A Job is created per component to clean up the registry
     //
-    // Afterwards, entities are destroyed consecutively
+    // Afterwards, entities are destroyed in bulk
+
+    struct ComponentCleanup {
+        void (World::*remove)() = nullptr;
+        // Creates the pools of the pass,
+        // returns whether removing the component only touches its own pools
+        bool (World::*prepare)() = nullptr;
+        bool pending = false;
+    };
 
     template <Component C> ALWAYS_INLINE void assure_cleanup_function() {
         const auto index = entt::type_index<C>::value();
@@ -102,24 +192,77 @@ private:
             m_componentCleanupFunctions.resize(size_t(index) + 1u);
         }
 
-        auto& func = m_componentCleanupFunctions[index];
-        if (!func) {
-            func = &remove_component_impl<C>;
+        auto& cleanup = m_componentCleanupFunctions[index];
+        if (!cleanup.remove) {
+            cleanup.remove = &World::remove_component_impl<C>;
+            cleanup.prepare = &World::prepare_component_cleanup<C>;
+        }
+
+        if (!cleanup.pending) {
+            cleanup.pending = true;
+            m_pendingComponentCleanups++;
         }
     }
 
+    // Replay every command buffer, called by cleanup()
+    void flush_commands();
+    void run_component_cleanups();
+    void destroy_tagged_entities();
+
     template <Component C> void remove_component_impl() {
         auto view = m_registry.view<const Components::ComponentRemovalTag<C>>();
-        for (Entity entity : view) {
-            m_registry.remove<Components::ComponentRemovalTag<C>, C>(entity);
-        }
+        m_registry.remove<C>(view.begin(), view.end());
+        m_registry.clear<Components::ComponentRemovalTag<C>>();
+    }
+
+    // Creating a pool inserts into the registry's pool map, so every pool a pass touches
+    // is created before passes run in parallel.
+    // Groups and observers listen for removals and touch other pools,
+    // these passes cannot run alongside others
+    template <Component C> bool prepare_component_cleanup() {
+        (void)m_registry.storage<C>();
+        (void)m_registry.storage<Components::ComponentRemovalTag<C>>();
+
+        return m_registry.on_destroy<C>().empty();
     }
 
     // Store the components that need to be removed at the end of the frame
-    std::mutex m_componentCleanupMutex;
-    std::vector<void (World::*)()> m_componentCleanupFunctions;
+    std::vector<ComponentCleanup> m_componentCleanupFunctions;
+
+    // Cheap checks so cleanup() does nothing when nothing changed
+    unsigned m_pendingComponentCleanups = 0;
+    unsigned m_pendingDestroyCount = 0;
+
+    // Reused between cleanups
+    std::vector<void (World::*)()> m_parallelCleanups;
+    std::vector<Entity> m_destroyQueue;
+
+    // Used by threads to find their command buffer
+    const uint64_t m_id;
+
+    // One command buffer per thread which has recorded commands
+    std::vector<std::pair<std::thread::id, std::unique_ptr<CommandBuffer>>> m_commandBuffers;
+    std::mutex m_commandBuffersMutex;
 
     ECSRegistry m_registry;
 };
 
+template <Component C>
+void CommandBuffer::apply_emplace(World& world, Entity entity, void* payload) {
+    // Removes are batched by cleanup() after the replay,
+    // an emplace recorded after a remove cancels it
+    const auto& removalTags =
+        std::as_const(world.m_registry).storage<Components::ComponentRemovalTag<C>>();
+    if (removalTags.contains(entity)) {
+        world.m_registry.remove<Components::ComponentRemovalTag<C>>(entity);
+    }
+
+    world.m_registry.emplace_or_replace<C>(entity, std::move(*static_cast<C*>(payload)));
+}
+
+template <Component C> void CommandBuffer::apply_remove(World& world, Entity entity, void*) {
+    world.assure_cleanup_function<C>();
+    world.m_registry.emplace_or_replace<Components::ComponentRemovalTag<C>>(entity);
+}
+
 } // namespace Arclight
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <Arclight/Core/Util.h>
+#include <Arclight/Graphics/Matrix.h>
+#include <Arclight/Vector.h>
+
+namespace Arclight {
+
+////////////////////////////////////////
+/// \brief Compact 2D affine transformation
+///
+/// Equivalent to the 2x3 matrix
+///     | a c tx |
+///     | b d ty |
+/// which is all a 2D transform needs, 24 bytes instead of the 64 of a Matrix4.
+////////////////////////////////////////
+struct Affine2D {
+    float a = 1.f;
+    float b = 0.f;
+    float c = 0.f;
+    float d = 1.f;
+    float tx = 0.f;
+    float ty = 0.f;
+
+    ALWAYS_INLINE Vector2f apply(const Vector2f& v) const {
+        return {a * v.x + c * v.y + tx, b * v.x + d * v.y + ty};
+    }
+
+    ////////////////////////////////////////
+    /// \brief Take the 2D part of a Matrix4, z is dropped
+    ////////////////////////////////////////
+    static ALWAYS_INLINE Affine2D from_matrix4(const Matrix4& matrix) {
+        const float* m = matrix.matrix();
+        return {m[0], m[1], m[4], m[5], m[12], m[13]};
+    }
+
+    ////////////////////////////////////////
+    /// \brief Expand to a Matrix4
+    ///
+    /// \param z Z translation (z index of the transform)
+    ////////////////////////////////////////
+    ALWAYS_INLINE Matrix4 to_matrix4(float z = 0.f) const {
+        return Matrix4(a, c, 0, tx,
+                       b, d, 0, ty,
+                       0, 0, 1, z,
+                       0, 0, 0, 1);
+    }
+};
+
+} // namespace Arclight
@@ -3,28 +3,90 @@
 #include <Arclight/Core/Resource.h>
 #include <Arclight/Core/NonCopyable.h>
 
+#include <atomic>
+#include <memory>
 #include <mutex>
+#include <thread>
+#include <unordered_map>
 #include <vector>
 
+// Pixel size signed distance field glyphs are generated at
+#define FONT_SDF_PIXEL_SIZE 48
+
 namespace Arclight {
 
 class Font final : public Resource, NonCopyable {
-    friend class Text;
+    friend class GlyphCache;
     ARCLIGHT_OBJECT(Font, Resource)
 public:
     Font();
     ~Font() override;
 
+    enum RenderMode {
+        RenderBitmap, // Glyphs are rasterised separately for every pixel size
+        RenderSDF,    // Glyphs are signed distance fields, one set serves every size and scale
+    };
+
+    ////////////////////////////////////////
+    /// \brief Load the font file
+    ///
+    /// Does nothing once the font is loaded, glyph caches may be referenced
+    /// and faces used by other threads so they are never replaced.
+    ////////////////////////////////////////
     int Load() override;
 
+    ////////////////////////////////////////
+    /// \brief Get the glyph cache for a pixel size, created on first use
+    ///
+    /// In RenderSDF mode every pixel size shares one cache generated at FONT_SDF_PIXEL_SIZE,
+    /// scale its metrics by pixelSize / GlyphCache::pixel_size().
+    /// Caches live as long as the font or until set_render_mode() changes the mode.
+    ////////////////////////////////////////
+    class GlyphCache& glyph_cache(int pixelSize);
+
+    ////////////////////////////////////////
+    /// \brief Set how glyphs are generated
+    ///
+    /// Drops every glyph cache, text using the font must be laid out again
+    /// (e.g. with Text::SetFont). Must not be called while text using the font is rendered.
+    ////////////////////////////////////////
+    void set_render_mode(RenderMode mode);
+    inline RenderMode render_mode() const { return m_renderMode; }
+
 private:
+    // FreeType face of one thread, all faces share m_fontData
+    struct ThreadFace {
+        std::thread::id thread;
+        void* library; // FreeType::Library the face belongs to, lock it to use the face
+        void* face;    // FT_Face
+    };
+
     int LoadImpl();
 
+    ////////////////////////////////////////
+    /// \brief Get the face of the calling thread, created on first use
+    ///
+    /// Faces are only used by their own thread, so threads rasterise glyphs in parallel.
+    ///
+    /// \param error Set to the FreeType error if creating the face fails
+    /// \return nullptr if the font is not loaded or the face could not be created
+    ////////////////////////////////////////
+    ThreadFace* thread_face(int* error = nullptr);
+    void release_faces();
+
     // Font data
     std::vector<uint8_t> m_fontData;
 
-    void* m_handle = nullptr; // Font handle, just an abstraction of the freetype object
-    std::mutex m_lock; // Font lock, should be acquired when text objects use the FreeType face
+    // Changes whenever the faces are released so threads do not use a stale cached face
+    std::atomic<uint64_t> m_id;
+
+    std::mutex m_facesLock;
+    std::vector<std::unique_ptr<ThreadFace>> m_faces;
+
+    RenderMode m_renderMode = RenderBitmap;
+
+    std::mutex m_glyphCacheLock;
+    std::unordered_map<int, std::unique_ptr<class GlyphCache>> m_glyphCaches; // By pixel size
 };
 
 } // namespace Arclight
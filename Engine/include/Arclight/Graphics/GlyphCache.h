@@ -0,0 +1,95 @@
+#pragma once
+
+#include <Arclight/Core/NonCopyable.h>
+#include <Arclight/Graphics/TextureAtlas.h>
+#include <Arclight/Vector.h>
+
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+// Width and height of a glyph atlas page in pixels
+#define GLYPHCACHE_PAGE_SIZE 512
+
+namespace Arclight {
+
+class Font;
+
+////////////////////////////////////////
+/// \brief Rasterised glyphs and metrics of a Font at one pixel size
+///
+/// Glyphs are rasterised the first time they are used and packed into
+/// an alpha only TextureAtlas, after that laying out text never touches FreeType.
+/// Get the cache of a font with Font::glyph_cache().
+///
+/// A signed distance field cache stores distances to the outline instead of coverage,
+/// draw its glyphs with Renderer::default_sdf_pipeline() at any scale.
+///
+/// Thread safe. Lookups take the cache lock, glyphs are rasterised outside of it
+/// with the FreeType face of the calling thread so threads rasterise in parallel.
+////////////////////////////////////////
+class GlyphCache final : NonCopyable {
+public:
+    struct Glyph {
+        TextureAtlas::Region region; // Invalid for glyphs without pixels, e.g. space
+        uint32_t index = 0;          // FreeType glyph index, 0 if the font lacks the glyph
+        Vector2i bearing = {0, 0};   // Left edge and top edge relative to the pen on the baseline
+        int advance = 0;             // Pixels to move the pen by
+    };
+
+    GlyphCache(Font& font, int pixelSize, bool sdf = false);
+
+    ////////////////////////////////////////
+    /// \brief Get a glyph, rasterising it if it is not in the cache yet
+    ///
+    /// \param codepoint Unicode codepoint
+    ////////////////////////////////////////
+    Glyph glyph(uint32_t codepoint);
+
+    ////////////////////////////////////////
+    /// \brief Kerning between two glyphs in pixels
+    ///
+    /// \param left Glyph index of the left glyph
+    /// \param right Glyph index of the right glyph
+    ////////////////////////////////////////
+    int kerning(uint32_t left, uint32_t right);
+
+    ////////////////////////////////////////
+    /// \brief Upload glyphs rasterised since the last flush
+    ////////////////////////////////////////
+    void flush();
+
+    inline bool is_sdf() const { return m_sdf; }
+    inline int pixel_size() const { return m_pixelSize; }
+    inline int line_height() const { return m_lineHeight; }
+    inline int ascender() const { return m_ascender; }
+
+private:
+    // Locks the calling thread's face of the font and sets it to the pixel size of the cache
+    class FaceLock;
+
+    struct Bitmap {
+        Glyph glyph;
+        std::vector<uint8_t> pixels; // Tightly packed rows
+        Vector2u size = {0, 0};
+    };
+
+    // Only uses the face of the calling thread, does not need the cache lock
+    Bitmap rasterise(uint32_t codepoint);
+
+    Font& m_font;
+    const int m_pixelSize;
+    const bool m_sdf;
+
+    int m_lineHeight = 0;
+    int m_ascender = 0; // Distance from the top of a line to the baseline
+    bool m_hasKerning = false;
+
+    std::mutex m_lock;
+    TextureAtlas m_atlas;
+    std::unordered_map<uint32_t, Glyph> m_glyphs; // By codepoint
+    std::unordered_map<uint64_t, int> m_kerning;  // By left glyph index << 32 | right glyph index
+};
+
+} // namespace Arclight
@@ -0,0 +1,168 @@
+#pragma once
+
+#include <Arclight/Core/NonCopyable.h>
+#include <Arclight/Core/Util.h>
+#include <Arclight/Graphics/Affine2D.h>
+#include <Arclight/Vector.h>
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+// Transforms per storage chunk, must be a multiple of 64 (one dirty word)
+#define TRANSFORMSTORAGE_CHUNK_SIZE 4096
+// Maximum chunks, the chunk table never reallocates so readers do not need a lock
+#define TRANSFORMSTORAGE_MAX_CHUNKS 1024
+
+namespace Arclight {
+
+////////////////////////////////////////
+/// \brief Structure of arrays storage backing every PackedTransform2D
+///
+/// Transform fields and the resulting matrices live in separate arrays
+/// so TransformStorage2D::rebuild_dirty() can process them with SIMD.
+/// Storage is split into fixed size chunks which are never moved,
+/// writing and reading a transform never takes a lock.
+/// Only allocating and releasing a slot does.
+////////////////////////////////////////
+class TransformStorage2D final : NonCopyable {
+public:
+    static constexpr uint32_t ChunkSize = TRANSFORMSTORAGE_CHUNK_SIZE;
+    static constexpr uint32_t MaxChunks = TRANSFORMSTORAGE_MAX_CHUNKS;
+    static constexpr uint32_t InvalidSlot = UINT32_MAX;
+
+    struct alignas(64) Chunk {
+        // Inputs
+        float positionX[ChunkSize];
+        float positionY[ChunkSize];
+        float zIndex[ChunkSize];
+        float scaleX[ChunkSize];
+        float scaleY[ChunkSize];
+        float rotation[ChunkSize]; // Radians
+        // Rotation is rarely changed compared to position,
+        // cache sin and cos so the rebuild is only multiplies
+        float sin[ChunkSize];
+        float cos[ChunkSize];
+
+        // Outputs, written by rebuild_dirty()
+        float a[ChunkSize];
+        float b[ChunkSize];
+        float c[ChunkSize];
+        float d[ChunkSize];
+        float tx[ChunkSize];
+        float ty[ChunkSize];
+
+        std::atomic<uint64_t> dirty[ChunkSize / 64];
+        std::atomic<bool> anyDirty = false;
+    };
+
+    TransformStorage2D() = default;
+    ~TransformStorage2D();
+
+    static TransformStorage2D& instance();
+
+    uint32_t allocate();
+    void release(uint32_t slot);
+
+    ////////////////////////////////////////
+    /// \brief Recalculate the matrices of all transforms changed since the last rebuild
+    ///
+    /// Chunks are rebuilt in parallel on the ThreadPool.
+    /// Must not run concurrently with anything modifying transforms.
+    ////////////////////////////////////////
+    void rebuild_dirty();
+
+    ALWAYS_INLINE Chunk& chunk(uint32_t slot) {
+        return *m_chunks[slot / ChunkSize].load(std::memory_order_relaxed);
+    }
+
+    ALWAYS_INLINE const Chunk& chunk(uint32_t slot) const {
+        return *m_chunks[slot / ChunkSize].load(std::memory_order_relaxed);
+    }
+
+    ALWAYS_INLINE static uint32_t chunk_index(uint32_t slot) { return slot % ChunkSize; }
+
+    ALWAYS_INLINE void mark_dirty(uint32_t slot) {
+        Chunk& c = chunk(slot);
+        uint32_t i = chunk_index(slot);
+
+        c.dirty[i / 64].fetch_or(uint64_t(1) << (i % 64), std::memory_order_relaxed);
+        if (!c.anyDirty.load(std::memory_order_relaxed)) {
+            c.anyDirty.store(true, std::memory_order_relaxed);
+        }
+    }
+
+    ALWAYS_INLINE Affine2D matrix(uint32_t slot) const {
+        const Chunk& c = chunk(slot);
+        uint32_t i = chunk_index(slot);
+
+        return {c.a[i], c.b[i], c.c[i], c.d[i], c.tx[i], c.ty[i]};
+    }
+
+    ALWAYS_INLINE uint32_t chunk_count() const {
+        return m_chunkCount.load(std::memory_order_acquire);
+    }
+
+private:
+    void rebuild_chunk(Chunk& chunk);
+
+    std::atomic<Chunk*> m_chunks[MaxChunks] = {};
+    std::atomic<uint32_t> m_chunkCount = 0;
+
+    std::mutex m_allocationLock;
+    std::vector<uint32_t> m_freeSlots;
+    uint32_t m_nextSlot = 0;
+};
+
+////////////////////////////////////////
+/// \brief 2D transform kept in TransformStorage2D
+///
+/// Same interface as Transform2D without the per object lock or cached Matrix4.
+/// Setters only mark the transform dirty, matrices are rebuilt in bulk by the
+/// Systems::transform_2d system and can then be read from any thread with matrix().
+///
+/// Like any other component, systems modifying it should declare
+/// Writes<PackedTransform2D> so they are not run alongside its readers.
+////////////////////////////////////////
+class PackedTransform2D final {
+public:
+    PackedTransform2D(const Vector2f& position = {0.f, 0.f}, const Vector2f& scale = {1.f, 1.f},
+                      float rotationDegrees = 0);
+    PackedTransform2D(const PackedTransform2D& other);
+    PackedTransform2D(PackedTransform2D&& other) noexcept;
+    ~PackedTransform2D();
+
+    PackedTransform2D& operator=(const PackedTransform2D& other);
+    PackedTransform2D& operator=(PackedTransform2D&& other) noexcept;
+
+    PackedTransform2D& set_position(const Vector2f& position);
+    ALWAYS_INLINE PackedTransform2D& set_position(float x, float y) { return set_position({x, y}); }
+    PackedTransform2D& set_z_index(float z);
+    PackedTransform2D& set_scale(const Vector2f& scale);
+    ALWAYS_INLINE PackedTransform2D& set_scale(float scaleX, float scaleY) {
+        return set_scale({scaleX, scaleY});
+    }
+    PackedTransform2D& set_rotation(float degrees);
+
+    PackedTransform2D& translate(const Vector2f& delta);
+
+    Vector2f get_position() const;
+    float get_z_index() const;
+    Vector2f get_scale() const;
+    float get_rotation() const; // Degrees
+
+    ////////////////////////////////////////
+    /// \brief Matrix as of the last TransformStorage2D::rebuild_dirty()
+    ////////////////////////////////////////
+    ALWAYS_INLINE Affine2D matrix() const { return TransformStorage2D::instance().matrix(m_slot); }
+
+    ALWAYS_INLINE uint32_t slot() const { return m_slot; }
+
+private:
+    void copy_from(const PackedTransform2D& other);
+
+    uint32_t m_slot;
+};
+
+} // namespace Arclight
@@ -0,0 +1,197 @@
+#pragma once
+
+#include <Arclight/Core/Fatal.h>
+#include <Arclight/Core/NonCopyable.h>
+
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+// Slots per chunk of a handle table, chunks are allocated as the table grows
+#define RENDERING_HANDLETABLE_CHUNK_SIZE 1024
+
+namespace Arclight::Rendering {
+
+////////////////////////////////////////
+/// \brief Dense table of renderer resources addressed by generational handles
+///
+/// Handles are the void* handles renderers hand out for textures, pipelines
+/// and vertex buffers. They encode the index of a slot, the generation of the slot
+/// and the tag of the table, and are never nullptr.
+/// Removing a resource bumps the generation of its slot, so get() returns nullptr
+/// for handles to destroyed resources even once the slot has been reused,
+/// and for handles from tables with another tag.
+/// Lookups are an index into an array and a compare.
+///
+/// Slots are allocated in chunks which never move, and the generation of a slot
+/// is released after its resource is stored or cleared, so get() may be called
+/// while another thread inserts or removes resources, even ones reusing the slot.
+/// insert() and erase() have to be serialised by the renderer (e.g. with a mutex).
+/// A handle must not be used while another thread is destroying it.
+////////////////////////////////////////
+template <typename T> class HandleTable final : NonCopyable {
+public:
+    using Handle = void*;
+
+    ////////////////////////////////////////
+    /// \param tag Tables whose handles can be passed to the same function
+    /// need different tags, from 0 to MaxTag
+    ////////////////////////////////////////
+    explicit HandleTable(unsigned tag = 0) : m_tag(tag) { assert(tag <= MaxTag); }
+
+    ////////////////////////////////////////
+    /// \brief Add a resource to the table
+    ///
+    /// The table does not own the resource.
+    ///
+    /// \return Handle to the resource
+    ////////////////////////////////////////
+    Handle insert(T* object) {
+        assert(object);
+
+        uint32_t index;
+        const bool reused = m_freeSlots.size();
+        if (reused) {
+            // Reuse the most recently freed slot, it is the most likely to be in cache
+            index = m_freeSlots.back();
+            m_freeSlots.pop_back();
+        } else {
+            index = m_slotCount.load(std::memory_order_relaxed);
+            if (index > IndexMask || index / ChunkSize >= MaxChunks) {
+                FatalRuntimeError("[Fatal error] HandleTable::insert: Out of handles!");
+            }
+
+            if (index % ChunkSize == 0) {
+                m_chunks[index / ChunkSize] = std::make_unique<Slot[]>(ChunkSize);
+            }
+        }
+
+        Slot& s = slot(index);
+        // The generation was bumped by erase(), handles to the previous resource stay invalid
+        const uintptr_t generation = s.generation.load(std::memory_order_relaxed);
+        s.object.store(object, std::memory_order_release);
+
+        if (!reused) {
+            // Publish the new slot to get() on other threads
+            m_slotCount.store(index + 1, std::memory_order_release);
+        }
+
+        return encode(index, generation);
+    }
+
+    ////////////////////////////////////////
+    /// \return Resource the handle refers to,
+    /// nullptr if it was removed or the handle is not from this table
+    ////////////////////////////////////////
+    inline T* get(Handle handle) const {
+        const uintptr_t value = reinterpret_cast<uintptr_t>(handle);
+        const uint32_t index = static_cast<uint32_t>(value & IndexMask);
+        if ((value >> TagShift) != m_tag ||
+            index >= m_slotCount.load(std::memory_order_acquire)) {
+            return nullptr;
+        }
+
+        const Slot& s = slot(index);
+        const uintptr_t generation = (value >> IndexBits) & GenerationMask;
+        if (s.generation.load(std::memory_order_acquire) != generation) {
+            return nullptr;
+        }
+
+        // The slot may be erased and reused meanwhile, a resource stored after the erase
+        // is only seen along with the new generation
+        T* object = s.object.load(std::memory_order_acquire);
+        if (s.generation.load(std::memory_order_relaxed) != generation) {
+            return nullptr;
+        }
+
+        return object;
+    }
+
+    inline bool contains(Handle handle) const { return get(handle) != nullptr; }
+
+    ////////////////////////////////////////
+    /// \brief Remove a resource from the table, its handle is invalid from then on
+    ///
+    /// \return Resource that was removed, nullptr if the handle was already invalid
+    ////////////////////////////////////////
+    T* erase(Handle handle) {
+        T* object = get(handle);
+        if (!object) {
+            return nullptr;
+        }
+
+        const uint32_t index =
+            static_cast<uint32_t>(reinterpret_cast<uintptr_t>(handle) & IndexMask);
+
+        Slot& s = slot(index);
+        s.object.store(nullptr, std::memory_order_relaxed);
+
+        // Generation 0 is skipped so handles are never nullptr
+        uintptr_t generation = (s.generation.load(std::memory_order_relaxed) + 1) & GenerationMask;
+        if (!generation) {
+            generation = 1;
+        }
+
+        s.generation.store(generation, std::memory_order_release);
+
+        m_freeSlots.push_back(index);
+        return object;
+    }
+
+    ////////////////////////////////////////
+    /// \brief Call fn with every resource in the table, in slot order
+    ///
+    /// fn must not insert or remove resources.
+    ////////////////////////////////////////
+    template <typename F> void for_each(F&& fn) const {
+        const uint32_t slotCount = m_slotCount.load(std::memory_order_acquire);
+        for (uint32_t i = 0; i < slotCount; i++) {
+            if (T* object = slot(i).object.load(std::memory_order_acquire)) {
+                fn(object);
+            }
+        }
+    }
+
+    // Number of resources in the table
+    inline size_t size() const { return m_slotCount.load() - m_freeSlots.size(); }
+
+    static constexpr unsigned TagBits = 2;
+    static constexpr unsigned MaxTag = (1u << TagBits) - 1;
+
+private:
+    // 32-bit platforms are limited to 1M resources per table
+    static constexpr unsigned IndexBits = sizeof(uintptr_t) >= 8 ? 32 : 20;
+    static constexpr unsigned GenerationBits = sizeof(uintptr_t) * 8 - IndexBits - TagBits;
+    static constexpr unsigned TagShift = IndexBits + GenerationBits;
+
+    static constexpr uintptr_t IndexMask = (uintptr_t{1} << IndexBits) - 1;
+    static constexpr uintptr_t GenerationMask = (uintptr_t{1} << GenerationBits) - 1;
+
+    static constexpr uint32_t ChunkSize = RENDERING_HANDLETABLE_CHUNK_SIZE;
+    static constexpr uint32_t MaxChunks = 4096;
+
+    struct Slot {
+        std::atomic<T*> object = nullptr;
+        std::atomic<uintptr_t> generation = 1;
+    };
+
+    inline Slot& slot(uint32_t index) const {
+        return m_chunks[index / ChunkSize][index % ChunkSize];
+    }
+
+    inline Handle encode(uint32_t index, uintptr_t generation) const {
+        return reinterpret_cast<Handle>((uintptr_t{m_tag} << TagShift) |
+                                        (generation << IndexBits) | index);
+    }
+
+    const uintptr_t m_tag;
+
+    std::unique_ptr<Slot[]> m_chunks[MaxChunks];
+    // Slots in use or freed, slots past it are not allocated yet
+    std::atomic<uint32_t> m_slotCount = 0;
+    std::vector<uint32_t> m_freeSlots;
+};
+
+} // namespace Arclight::Rendering
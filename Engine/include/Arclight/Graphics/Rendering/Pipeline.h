@@ -36,10 +36,19 @@ public:
 		PrimitiveTriangleStrip, // List of connected triangles, each triangle shares the last two vertices
 	};
 
+	enum VertexLayout {
+		VertexLayoutDefault, // Vertex (see Vertex.h)
+		VertexLayoutSpriteInstance, // Unit quad position per vertex, SpriteInstance per instance
+	};
+
 	struct PipelineFixedConfig {
 		RasterizerConfig rasterizer;
 		ColourBlending blending;
 		PrimitiveType topology;
+		VertexLayout vertexLayout = VertexLayoutDefault;
+		// Shaders sample the bindless texture table with a texture index per draw or per instance,
+		// only for renderers where Renderer::has_bindless_textures() is true
+		bool bindlessTextures = false;
 	};
 
 	RenderPipeline(const Shader& vertexShader, const Shader& fragmentShader, const PipelineFixedConfig& config = defaultConfig);
@@ -0,0 +1,239 @@
+#pragma once
+
+#include <Arclight/Core/NonCopyable.h>
+#include <Arclight/Graphics/Rendering/Renderer.h>
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Capture file format version, bump on any change to the commands
+#define RENDERCAPTURE_VERSION 2
+// Bytes of recorded commands buffered before they are written to the file
+#define RENDERCAPTURE_FLUSH_SIZE (1024 * 1024)
+
+namespace Arclight {
+class File;
+
+namespace Rendering {
+
+////////////////////////////////////////
+/// \brief Records every call made to a renderer into a capture file
+///
+/// Wraps another renderer and forwards every call to it, so it can be placed
+/// in front of any backend. Resource handles are recorded as IDs,
+/// texture and vertex data are recorded as they are uploaded.
+/// Writes through get_vertex_buffer_mapping() are recorded at the next render()
+/// by comparing mapped buffers with a copy of their last recorded contents,
+/// transient allocations are recorded whole at the next render().
+///
+/// Becomes Renderer::instance() once initialized.
+/// Set the ARCLIGHT_RENDER_CAPTURE environment variable to a file path
+/// to capture everything the engine renders, replay it with CaptureReplay (arclight-replay).
+///
+/// Draws can still be submitted from any thread but are serialised by a lock.
+/// Capture files use the byte order of the machine that wrote them.
+////////////////////////////////////////
+class CaptureRenderer final : public Renderer {
+public:
+    ////////////////////////////////////////
+    /// \param renderer Initialized renderer to forward to, must outlive the CaptureRenderer
+    /// \param path Capture file to write
+    ////////////////////////////////////////
+    CaptureRenderer(Renderer& renderer, const std::string& path);
+    ~CaptureRenderer() override;
+
+    ////////////////////////////////////////
+    /// \return Non zero if the capture file could not be created
+    ////////////////////////////////////////
+    int initialize(class WindowContext* context) override;
+
+    void wait_device_idle() const override { m_renderer.wait_device_idle(); }
+
+    void render() override;
+    void clear() override { m_renderer.clear(); }
+    void resize_viewport(const Vector2i& newPixelSize) override;
+
+    void bind_texture(Texture::TextureHandle texture) override;
+    void bind_vertex_buffer(void* buffer) override;
+    void bind_pipeline(RenderPipeline::PipelineHandle pipeline) override;
+
+    void draw(void* vertexBuffer, unsigned firstVertex, unsigned vertexCount,
+              const Matrix4& transform, const Matrix4& view, Texture::TextureHandle texture,
+              RenderPipeline::PipelineHandle renderPipeline, uint8_t layer = 0) override;
+    void draw_quads(void* vertexBuffer, unsigned firstVertex, unsigned quadCount,
+                    const Matrix4& transform, const Matrix4& view, Texture::TextureHandle texture,
+                    RenderPipeline::PipelineHandle renderPipeline, uint8_t layer = 0) override;
+    void draw_instanced(const SpriteInstance* instances, unsigned instanceCount,
+                        const Matrix4& view, Texture::TextureHandle texture,
+                        RenderPipeline::PipelineHandle renderPipeline = nullptr,
+                        uint8_t layer = 0) override;
+
+    RenderPipeline::PipelineHandle
+    create_pipeline(const Shader& vertexShader, const Shader& fragmentShader,
+                    const RenderPipeline::PipelineFixedConfig& config) override;
+    void destroy_pipeline(RenderPipeline::PipelineHandle handle) override;
+
+    RenderPipeline& default_pipeline() override { return m_renderer.default_pipeline(); }
+    RenderPipeline& default_batch_pipeline() override {
+        return m_renderer.default_batch_pipeline();
+    }
+    RenderPipeline& default_instanced_pipeline() override {
+        return m_renderer.default_instanced_pipeline();
+    }
+    RenderPipeline& default_sdf_pipeline() override { return m_renderer.default_sdf_pipeline(); }
+    RenderPipeline& default_sdf_instanced_pipeline() override {
+        return m_renderer.default_sdf_instanced_pipeline();
+    }
+
+    Texture::TextureHandle allocate_texture(const Vector2u& bounds,
+                                            Texture::Format texFormat) override;
+    void update_texture(Texture::TextureHandle texture, const void* data) override;
+    void destroy_texture(Texture::TextureHandle texture) override;
+
+    void* allocate_vertex_buffer(unsigned vertexCount) override;
+    void update_vertex_buffer(void* buffer, unsigned int offset, unsigned int size,
+                              const Vertex* vertices) override;
+    void* get_vertex_buffer_mapping(void* buffer) override;
+    void destroy_vertex_buffer(void* buffer) override;
+
+    TransientAllocation allocate_transient(size_t size) override;
+
+    const std::string& get_name() const override { return m_renderer.get_name(); }
+
+private:
+    struct TextureInfo {
+        uint32_t id;
+        Vector2u size;
+        Texture::Format format;
+    };
+
+    struct VertexBufferInfo {
+        uint32_t id;
+        unsigned vertexCount;
+        // Contents as last recorded, only kept for buffers that were mapped
+        std::vector<Vertex> shadow;
+        Vertex* mapping = nullptr;
+    };
+
+    // Everything goes through the renderer being captured
+    void do_draw_call(unsigned, unsigned, const Matrix4&, const Matrix4&) override {}
+    void do_draw_indexed_call(unsigned, unsigned, const Matrix4&, const Matrix4&) override {}
+    void upload_instances(const SpriteInstance*, unsigned) override {}
+    void do_draw_instanced_call(unsigned, unsigned, const Matrix4&) override {}
+
+    // All of these expect m_lock to be held
+    template <typename T> void write(const T& value);
+    void write_bytes(const void* data, size_t size);
+    void write_view(const Matrix4& view);
+    void write_draw(uint8_t command, void* vertexBuffer, unsigned first, unsigned count,
+                    const Matrix4& transform, const Matrix4& view, Texture::TextureHandle texture,
+                    RenderPipeline::PipelineHandle pipeline, uint8_t layer);
+    // Record writes through vertex buffer mappings since the last frame
+    void write_mapped_vertex_buffers();
+    // Record the contents of the transient allocations of the frame
+    void write_transients();
+    void flush();
+
+    uint32_t pipeline_id(RenderPipeline::PipelineHandle pipeline);
+    uint32_t texture_id(Texture::TextureHandle texture) const;
+    uint32_t vertex_buffer_id(void* buffer) const;
+
+    Renderer& m_renderer;
+    const std::string m_path;
+    File* m_file = nullptr;
+
+    std::mutex m_lock;
+    std::vector<uint8_t> m_buffer;
+
+    std::unordered_map<RenderPipeline::PipelineHandle, uint32_t> m_pipelines;
+    std::unordered_map<Texture::TextureHandle, TextureInfo> m_textures;
+    std::unordered_map<void*, VertexBufferInfo> m_vertexBuffers;
+    // Transient allocations of the frame with their sizes, draws refer to them by index
+    std::vector<std::pair<TransientAllocation, size_t>> m_transients;
+    uint32_t m_nextPipelineID;
+    uint32_t m_nextTextureID = 1;
+    uint32_t m_nextVertexBufferID = 1;
+
+    // Last view written, draws only write the view when it changes
+    Matrix4 m_view;
+    bool m_hasView = false;
+    // Draw call sorting as last recorded
+    bool m_recordedSorting = true;
+};
+
+////////////////////////////////////////
+/// \brief Replays a capture written by CaptureRenderer
+///
+/// Loads the whole capture into memory, then issues the calls of one frame at a time
+/// against any renderer so backends can be compared on identical workloads.
+/// Pipelines with custom shaders are only recreated on the backend that was captured,
+/// other backends use the default pipeline with the same vertex layout.
+////////////////////////////////////////
+class CaptureReplay final : NonCopyable {
+public:
+    CaptureReplay(Renderer& renderer);
+    // Destroys everything created by the replay
+    ~CaptureReplay();
+
+    ////////////////////////////////////////
+    /// \brief Load a capture file
+    ///
+    /// \return false if the file can not be read or is not a valid capture
+    ////////////////////////////////////////
+    bool load(const std::string& path);
+
+    ////////////////////////////////////////
+    /// \brief Issue every call of a frame, ending with Renderer::render()
+    ///
+    /// Frames have to be replayed in order starting at 0,
+    /// as they use resources created by earlier frames.
+    ///
+    /// \return false if the capture is corrupt
+    ////////////////////////////////////////
+    bool replay_frame(unsigned frame);
+
+    ////////////////////////////////////////
+    /// \brief Destroy everything created by the replay so it can start over at frame 0
+    ////////////////////////////////////////
+    void reset();
+
+    inline unsigned frame_count() const { return static_cast<unsigned>(m_frames.size()); }
+    // Name of the renderer the capture was recorded with
+    inline const std::string& captured_renderer() const { return m_capturedRenderer; }
+
+private:
+    class Reader;
+
+    // Parse one command, only calling the renderer if issue is set
+    bool run_command(Reader& reader, uint8_t command, bool issue);
+    RenderPipeline::PipelineHandle pipeline(uint32_t id);
+
+    Renderer& m_renderer;
+
+    std::vector<uint8_t> m_data;
+    // Offset of the first command of each frame, the last frame ends at the next offset
+    std::vector<size_t> m_frames;
+    std::string m_capturedRenderer;
+
+    // Handles by capture ID
+    std::vector<RenderPipeline::PipelineHandle> m_pipelines;
+    std::vector<Texture::TextureHandle> m_textures;
+    std::vector<void*> m_vertexBuffers;
+    // Sizes by capture ID to validate updates, texture sizes are in bytes
+    std::vector<size_t> m_textureSizes;
+    std::vector<unsigned> m_vertexBufferSizes;
+    // Transient allocations of the frame being replayed and their sizes by index
+    std::vector<Renderer::TransientAllocation> m_transients;
+    std::vector<size_t> m_transientSizes;
+    // Pipelines created by the replay, default pipelines are not destroyed
+    std::vector<RenderPipeline::PipelineHandle> m_createdPipelines;
+
+    Matrix4 m_view;
+    bool m_warnedCustomPipeline = false;
+};
+
+} // namespace Rendering
+} // namespace Arclight
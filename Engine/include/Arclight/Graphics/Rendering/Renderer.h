@@ -1,19 +1,31 @@
 #pragma once
 
+#include <cstdint>
+#include <cstring>
+#include <memory>
 #include <mutex>
 #include <set>
 #include <stack>
 #include <string>
+#include <thread>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
+#include <Arclight/Core/Util.h>
 #include <Arclight/Graphics/Rendering/Pipeline.h>
+#include <Arclight/Graphics/Rendering/SpriteInstance.h>
 
+#include <Arclight/Graphics/Affine2D.h>
 #include <Arclight/Graphics/Texture.h>
 #include <Arclight/Graphics/Transform.h>
 #include <Arclight/Graphics/Vertex.h>
 
 #include <Arclight/Platform/API.h>
 
+// Alignment of transient allocations, a multiple of sizeof(Vertex)
+#define RENDERER_TRANSIENT_ALIGNMENT 64
+
 namespace Arclight {
 class WindowContext;
 
@@ -21,12 +33,26 @@ namespace Rendering {
 
 class ARCLIGHT_API Renderer {
 public:
+    Renderer();
     virtual ~Renderer() = default;
 
     virtual int initialize(class WindowContext* context) = 0;
     static inline Renderer* instance() { return s_rendererInstance; }
 
+    ////////////////////////////////////////
+    /// \brief Issue every draw call submitted since the last render
+    ///
+    /// Must not run concurrently with draw(), draw_quads() or draw_instanced().
+    ////////////////////////////////////////
     virtual void render();
+
+    ////////////////////////////////////////
+    /// \brief Enable or disable draw call sorting (enabled by default)
+    ///
+    /// When disabled render() issues draw calls in the order they were submitted
+    /// on each thread, threads in the order they first submitted.
+    ////////////////////////////////////////
+    ALWAYS_INLINE void set_draw_call_sorting(bool enabled) { m_sortDrawCalls = enabled; }
     virtual void wait_device_idle() const = 0;
 
     ////////////////////////////////////////
@@ -69,17 +95,86 @@ public:
     /// \brief Draw
     ///
     ///	Draw a polygon. Generally corresponds to a draw call.
+    /// Can be called from any thread without locking.
+    ///
+    /// Draws are not issued in submission order, render() sorts them by layer,
+    /// then back to front by the z translation of transform,
+    /// then by pipeline, texture and vertex buffer.
+    /// Draws with the same layer and z keep their submission order
+    /// unless they use different state.
     ///
     /// \param vertexBuffer Handle of vertex buffer
     /// \param firstVertex First vertex in vertex buffer to draw
     /// \param vertexCount Amount of vertices to draw
-    /// \param transform Transformation matrix to apply
+    /// \param transform Transformation matrix to apply,
+    /// only the 2D affine part and the z translation are kept
     /// \param texture Texture to use in shader
     /// \param renderPipeline Render pipeline to use
+    /// \param layer Layers are drawn in ascending order before anything else is considered
     ////////////////////////////////////////
     virtual void draw(void* vertexBuffer, unsigned firstVertex, unsigned vertexCount,
                       const Matrix4& transform, const Matrix4& view, Texture::TextureHandle texture,
-                      RenderPipeline::PipelineHandle renderPipeline);
+                      RenderPipeline::PipelineHandle renderPipeline, uint8_t layer = 0);
+
+    ////////////////////////////////////////
+    /// \brief Draw quads
+    ///
+    /// Draw consecutive quads with a single indexed draw call.
+    /// Each quad is 4 vertices in the same order as Sprite::vertices
+    /// (bottom left, top left, bottom right, top right).
+    ///
+    /// \param vertexBuffer Handle of vertex buffer
+    /// \param firstVertex First vertex of the first quad
+    /// \param quadCount Amount of quads to draw
+    /// \param transform Transformation matrix to apply to every quad
+    /// \param texture Texture to use in shader
+    /// \param renderPipeline Render pipeline to use, must use PrimitiveTriangleList
+    /// (see default_batch_pipeline())
+    /// \param layer See draw()
+    ////////////////////////////////////////
+    virtual void draw_quads(void* vertexBuffer, unsigned firstVertex, unsigned quadCount,
+                            const Matrix4& transform, const Matrix4& view,
+                            Texture::TextureHandle texture,
+                            RenderPipeline::PipelineHandle renderPipeline, uint8_t layer = 0);
+
+    ////////////////////////////////////////
+    /// \brief Draw instanced sprites
+    ///
+    /// Draw a unit quad once for each instance with a single instanced draw call.
+    /// Instances are copied, the array does not need to outlive the call.
+    /// The draw is sorted as a whole using the z index of the first instance,
+    /// instances with another z index should go in their own draw to blend correctly.
+    ///
+    /// \param instances Instances to draw
+    /// \param instanceCount Amount of instances
+    /// \param texture Texture to use in shader, with bindless textures nullptr samples
+    /// the texture of each instance (see bindless_texture_index())
+    /// \param renderPipeline Render pipeline to use, must use VertexLayoutSpriteInstance
+    /// (see default_instanced_pipeline())
+    /// \param layer See draw()
+    ////////////////////////////////////////
+    virtual void draw_instanced(const SpriteInstance* instances, unsigned instanceCount,
+                                const Matrix4& view, Texture::TextureHandle texture,
+                                RenderPipeline::PipelineHandle renderPipeline = nullptr,
+                                uint8_t layer = 0);
+
+    ////////////////////////////////////////
+    /// \brief Whether the default pipelines sample a bindless texture table
+    ///
+    /// Every texture is in one table for the lifetime of the texture, so binding a texture
+    /// costs no descriptor updates and the instances of one draw_instanced() call
+    /// can use different textures.
+    ////////////////////////////////////////
+    virtual bool has_bindless_textures() const { return false; }
+
+    ////////////////////////////////////////
+    /// \brief Index of a texture in the bindless texture table
+    ///
+    /// Set as SpriteInstance::textureIndex and pass no texture to draw_instanced()
+    /// to draw instances with different textures in one draw call.
+    /// Only meaningful if has_bindless_textures() is true, the texture handle must be valid.
+    ////////////////////////////////////////
+    virtual uint32_t bindless_texture_index(Texture::TextureHandle) const { return 0; }
 
     ////////////////////////////////////////
     /// \brief create_pipeline
@@ -101,12 +196,44 @@ public:
     /// \brief DestroyPipeline
     ///
     ///	Destroy render pipeline. MUST be a valid handle.
+    /// Draws already queued with the pipeline are skipped by render().
     ///
     /// \param handle Valid pipeline handle
     ////////////////////////////////////////
-    virtual void destroy_pipeline(RenderPipeline::PipelineHandle handle);
+    virtual void destroy_pipeline(RenderPipeline::PipelineHandle handle) = 0;
+
+    ////////////////////////////////////////
+    /// \brief Whether a pipeline handle still refers to a pipeline
+    ///
+    /// Checked by render() so draws queued before their pipeline was destroyed are skipped.
+    /// May be called while other threads create or destroy pipelines.
+    ////////////////////////////////////////
+    virtual bool pipeline_valid(RenderPipeline::PipelineHandle) const { return true; }
     virtual RenderPipeline& default_pipeline() = 0;
 
+    ////////////////////////////////////////
+    /// \brief Default shaders with a triangle list topology, used for draw_quads
+    ////////////////////////////////////////
+    virtual RenderPipeline& default_batch_pipeline() = 0;
+
+    ////////////////////////////////////////
+    /// \brief Default instanced sprite shaders, used for draw_instanced
+    ////////////////////////////////////////
+    virtual RenderPipeline& default_instanced_pipeline() = 0;
+
+    ////////////////////////////////////////
+    /// \brief Signed distance field text shaders, used with draw_quads
+    ///
+    /// Expects an alpha only texture holding distances with the outline at 0.5,
+    /// see Font::RenderSDF.
+    ////////////////////////////////////////
+    virtual RenderPipeline& default_sdf_pipeline() = 0;
+
+    ////////////////////////////////////////
+    /// \brief Signed distance field text shaders, used with draw_instanced
+    ////////////////////////////////////////
+    virtual RenderPipeline& default_sdf_instanced_pipeline() = 0;
+
     ////////////////////////////////////////
     /// \brief allocate_texture
     ///
@@ -165,31 +292,158 @@ public:
     ////////////////////////////////////////
     virtual void destroy_vertex_buffer(void* buffer) = 0;
 
+    ////////////////////////////////////////
+    /// \brief Memory for data that is only used by the current frame
+    ////////////////////////////////////////
+    struct TransientAllocation {
+        void* data = nullptr;         // Host memory to write the data to
+        void* vertexBuffer = nullptr; // Vertex buffer handle the memory belongs to
+        size_t offset = 0;            // In bytes from the start of vertexBuffer
+
+        // Vertex to pass to draw() or draw_quads() to start at the allocation
+        ALWAYS_INLINE unsigned first_vertex() const {
+            return static_cast<unsigned>(offset / sizeof(Vertex));
+        }
+    };
+
+    ////////////////////////////////////////
+    /// \brief allocate_transient
+    ///
+    /// Allocate memory for vertex data written every frame.
+    /// Backends hand out persistently mapped memory with a region for every frame in flight,
+    /// so writes never touch memory the GPU may still be reading and nothing is reallocated
+    /// once the regions have grown to fit a frame.
+    ///
+    /// Write the data and submit the draws using it before the next render(),
+    /// the allocation is invalid afterwards. Can be called from any thread,
+    /// but not concurrently with render().
+    ///
+    /// \param size Size in bytes
+    ///
+    /// \return Allocation aligned to RENDERER_TRANSIENT_ALIGNMENT, data is nullptr on failure
+    ////////////////////////////////////////
+    virtual TransientAllocation allocate_transient(size_t size) = 0;
+
     virtual const std::string& get_name() const = 0;
 
 protected:
+    // Kept small as every draw is copied into a submission buffer,
+    // expanded back into matrices when the call is issued
     struct DrawCall {
+        Affine2D transform;
+        float zIndex;
+        uint32_t viewIndex; // Into the view table of the submission buffer, then m_views
+
         unsigned firstVertex;
         unsigned vertexCount;
-        Matrix4 transform;
-        Matrix4 view;
+        unsigned indexCount; // Non zero for draw_quads
+
         void* vertexBuffer;
         Texture::TextureHandle texture;
+        RenderPipeline::PipelineHandle pipeline;
+        uint8_t layer;
+        // firstVertex and vertexCount are the first instance and instance count
+        bool instanced;
+    };
+
+    struct SortedDrawCall {
+        uint64_t key;
+        const DrawCall* call;
+    };
+
+    // Draw calls recorded by one thread, only that thread touches it until render()
+    struct SubmissionBuffer {
+        // Cleared every frame, capacity is kept
+        std::vector<DrawCall> calls;
+        // Almost every draw in a frame uses the same view,
+        // only add a view when it differs from the last one
+        std::vector<Matrix4> views;
+        std::vector<SpriteInstance> instances;
+
+        ALWAYS_INLINE uint32_t view_index(const Matrix4& view) {
+            if (views.empty() ||
+                std::memcmp(views.back().matrix(), view.matrix(), sizeof(float) * 16)) {
+                views.push_back(view);
+            }
+
+            return static_cast<uint32_t>(views.size() - 1);
+        }
     };
 
-    struct DrawQueue {
-        DrawCall* calls = nullptr;
-        unsigned callCount = 0;
+    static uint64_t sort_key(const DrawCall& drawCall);
+
+    // Round an offset into transient memory up to RENDERER_TRANSIENT_ALIGNMENT
+    static ALWAYS_INLINE size_t align_transient(size_t offset) {
+        return (offset + RENDERER_TRANSIENT_ALIGNMENT - 1) &
+               ~static_cast<size_t>(RENDERER_TRANSIENT_ALIGNMENT - 1);
+    }
+
+    // Block of transient memory, created and destroyed by the backend
+    struct TransientBlock {
+        uint8_t* data = nullptr;      // Host memory, nullptr if the block could not be created
+        size_t size = 0;              // In bytes
+        size_t used = 0;              // In bytes, this frame
+        void* vertexBuffer = nullptr; // Handle bound through bind_vertex_buffer()
+        void* backend = nullptr;      // Backend's own block
+    };
 
-        unsigned size = 0;
+    ////////////////////////////////////////
+    /// \brief Linear allocator over transient blocks
+    ///
+    /// Usually one block, a frame that overflows it chains more blocks
+    /// which reset() replaces by one block that fits the whole frame,
+    /// so steady state frames allocate from a single block without creating any.
+    /// Not thread safe, backends lock around it.
+    ////////////////////////////////////////
+    class TransientChain final {
+    public:
+        explicit TransientChain(size_t initialBlockSize) : m_initialBlockSize(initialBlockSize) {}
+
+        TransientAllocation allocate(Renderer& renderer, size_t size);
+        // Start allocating from the beginning of the chain again,
+        // once nothing reads the memory of the frame anymore
+        void reset(Renderer& renderer);
+        // Destroys the blocks right away
+        void destroy(Renderer& renderer);
+
+        ALWAYS_INLINE const std::vector<TransientBlock>& blocks() const { return m_blocks; }
+
+    private:
+        std::vector<TransientBlock> m_blocks; // Allocations are made from the last one
+        size_t m_frameSize = 0;               // Allocated in every block this frame
+        size_t m_initialBlockSize;
     };
 
+    // Used by TransientChain, the default fails every allocation
+    virtual TransientBlock create_transient_block(size_t) { return {}; }
+    virtual void destroy_transient_block(const TransientBlock&) {}
+
     virtual void do_draw_call(unsigned firstVertex, unsigned vertexCount, const Matrix4& transform, const Matrix4& view) = 0;
 
-    std::mutex m_draw_queue_mutex;
+    SubmissionBuffer& submission_buffer();
+
+    // Indices are taken from a shared quad index buffer (0, 1, 2, 2, 1, 3 for each quad),
+    // firstVertex is added to each index
+    virtual void do_draw_indexed_call(unsigned firstVertex, unsigned indexCount, const Matrix4& transform, const Matrix4& view) = 0;
+
+    // Called by render() before any draw call with every instance of the frame
+    virtual void upload_instances(const SpriteInstance* instances, unsigned instanceCount) = 0;
+    // Draw the unit quad for instanceCount instances starting at firstInstance
+    virtual void do_draw_instanced_call(unsigned firstInstance, unsigned instanceCount, const Matrix4& view) = 0;
+
+    // Only locked the first time a thread submits and by render()
+    std::mutex m_submissionBuffersMutex;
+    std::vector<std::pair<std::thread::id, std::unique_ptr<SubmissionBuffer>>>
+        m_submissionBuffers;
+
+    std::vector<SortedDrawCall> m_sortedDrawCalls;
+    std::vector<SortedDrawCall> m_sortScratch;
+    // Views of every submission buffer, rebuilt by render()
+    std::vector<Matrix4> m_views;
+    std::vector<SpriteInstance> m_instances;
+    bool m_sortDrawCalls = true;
 
-    // Do NOT preserve queue order, use stack
-    std::unordered_map<void*, DrawQueue> m_queues;
+    const uint64_t m_id;
 
     static Renderer* s_rendererInstance;
 };
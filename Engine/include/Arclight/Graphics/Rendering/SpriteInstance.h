@@ -0,0 +1,66 @@
+#pragma once
+
+#include <Arclight/Core/Util.h>
+#include <Arclight/Graphics/Affine2D.h>
+#include <Arclight/Graphics/Rect.h>
+#include <Arclight/Vector.h>
+
+#include <algorithm>
+#include <cstdint>
+
+namespace Arclight::Rendering {
+
+////////////////////////////////////////
+/// \brief Per instance data of the instanced sprite path
+///
+/// Every instance is the unit quad (0, 0) to (1, 1) transformed by
+/// transform and translation, the size of the sprite is part of the transform.
+/// Layout matches the per instance vertex attributes of the default instanced shaders.
+////////////////////////////////////////
+struct SpriteInstance {
+    float transform[4];   // a, b, c, d of the Affine2D
+    float translation[3]; // tx, ty and z index
+    uint32_t colour;      // RGBA8, red in the lowest byte
+    float uvRect[4];      // left, top, right, bottom
+    // Index of the texture in the bindless texture table, see Renderer::bindless_texture_index.
+    // Only used when draw_instanced is passed no texture.
+    uint32_t textureIndex;
+
+    ////////////////////////////////////////
+    /// \brief Create an instance covering rect in local space
+    ///
+    /// \param rect Position and size of the quad before transform is applied
+    /// \param transform Local to world transform
+    /// \param zIndex Z index
+    /// \param uv Texture coordinates of the top left and bottom right corners
+    /// \param colour Colour, each component from 0 to 1
+    ////////////////////////////////////////
+    static ALWAYS_INLINE SpriteInstance create(const Rectf& rect, const Affine2D& transform,
+                                               float zIndex, const Rectf& uv,
+                                               const Vector4f& colour) {
+        const float w = rect.right - rect.left;
+        const float h = rect.bottom - rect.top;
+        const Vector2f origin = transform.apply({rect.left, rect.top});
+
+        return {
+            .transform = {transform.a * w, transform.b * w, transform.c * h, transform.d * h},
+            .translation = {origin.x, origin.y, zIndex},
+            .colour = pack_colour(colour),
+            .uvRect = {uv.left, uv.top, uv.right, uv.bottom},
+            .textureIndex = 0,
+        };
+    }
+
+    static ALWAYS_INLINE uint32_t pack_colour(const Vector4f& colour) {
+        auto channel = [](float c) -> uint32_t {
+            return static_cast<uint32_t>(std::clamp(c, 0.f, 1.f) * 255.f + 0.5f);
+        };
+
+        return channel(colour.x) | (channel(colour.y) << 8) | (channel(colour.z) << 16) |
+               (channel(colour.w) << 24);
+    }
+};
+
+static_assert(sizeof(SpriteInstance) == 52);
+
+} // namespace Arclight::Rendering
@@ -10,6 +10,7 @@
 #include <Arclight/Vector.h>
 
 #include <memory>
+#include <vector>
 
 namespace Arclight {
 
@@ -27,28 +28,32 @@ public:
     void SetText(UnicodeString text);
     void SetFontSize(int size);
 
-    ALWAYS_INLINE Texture& tex() { return m_texture; }
-    ALWAYS_INLINE const Vertex* vertices() const { return m_vertices; }
+    // One quad of 4 vertices per visible glyph
+    ALWAYS_INLINE size_t quad_count() const { return m_quadTextures.size(); }
+    ALWAYS_INLINE const Vertex* vertices() const { return m_vertices.data(); }
+    // Glyph atlas page of a quad
+    ALWAYS_INLINE Texture::TextureHandle quad_texture(size_t quad) const {
+        return m_quadTextures[quad];
+    }
     ALWAYS_INLINE const Vector2f Bounds() const { return m_bounds.end; }
+    // Glyphs are signed distance fields, draw with Renderer::default_sdf_pipeline()
+    ALWAYS_INLINE bool is_sdf() const { return m_sdf; }
 
 private:
     void render();
 
     std::shared_ptr<Font> m_font = nullptr;
 
-    // Freetype is used to render the text to this texture
-    // The texture contains the final result of what is rendered on screen
-    Texture m_texture;
-    Vertex m_vertices[4] = {
-        {{0, 1.0f}, {0.0f, 1.0f}, {1.f, 1.f, 1.f, 1.f}},    // Bottom left
-        {{0, 0}, {0.0f, 0.0f}, {1.f, 1.f, 1.f, 1.f}},       // Top left
-        {{1.0f, 1.0f}, {1.0f, 1.0f}, {1.f, 1.f, 1.f, 1.f}}, // Bottom right
-        {{1.0f, 0}, {1.0f, 0.0f}, {1.f, 1.f, 1.f, 1.f}},    // Top right
-    };
+    // Glyph quads, texture coordinates point into the GlyphCache of the font and size.
+    // Changing the text only rewrites these.
+    std::vector<Vertex> m_vertices;
+    std::vector<Texture::TextureHandle> m_quadTextures;
 
     UnicodeString m_text; // Text to render
     Rectf m_bounds;       // Bounds of the text
+    Vector4f m_colour = {1.f, 1.f, 1.f, 1.f};
     int m_pixelSize = 24;
+    bool m_sdf = false;
 };
 
-} // namespace Arclight
\ No newline at end of file
+} // namespace Arclight
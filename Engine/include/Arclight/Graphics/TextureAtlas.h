@@ -0,0 +1,155 @@
+#pragma once
+
+#include <Arclight/Components/Sprite.h>
+#include <Arclight/Core/NonCopyable.h>
+#include <Arclight/Graphics/Image.h>
+#include <Arclight/Graphics/Rect.h>
+#include <Arclight/Graphics/Texture.h>
+#include <Arclight/Vector.h>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+// Default width and height of an atlas page in pixels
+#define TEXTUREATLAS_DEFAULT_PAGE_SIZE 2048
+// Empty pixels kept around every region so filtering does not bleed between them
+#define TEXTUREATLAS_PADDING 1
+
+namespace Arclight {
+
+////////////////////////////////////////
+/// \brief Skyline bottom left rectangle packer
+///
+/// Tracks the top edge of the packed area as a list of horizontal segments,
+/// each rectangle is placed where its bottom edge ends up lowest.
+/// Fast and works well when rectangles are added at runtime in no particular order.
+////////////////////////////////////////
+class SkylinePacker final {
+public:
+    SkylinePacker(const Vector2u& size);
+
+    ////////////////////////////////////////
+    /// \brief Find space for a rectangle
+    ///
+    /// \param size Size of the rectangle
+    /// \param position Set to the top left corner of the rectangle
+    /// \return false if the rectangle does not fit
+    ////////////////////////////////////////
+    bool insert(const Vector2u& size, Vector2u& position);
+
+    void clear();
+
+    inline const Vector2u& size() const { return m_size; }
+
+private:
+    struct Segment {
+        uint32_t x;
+        uint32_t y; // Top of the free space above the segment
+        uint32_t width;
+    };
+
+    // Returns the y a rectangle of size placed at segment index would have,
+    // or UINT32_MAX if it does not fit
+    uint32_t fit(size_t index, const Vector2u& size) const;
+
+    Vector2u m_size;
+    std::vector<Segment> m_skyline;
+};
+
+////////////////////////////////////////
+/// \brief Packs many small images into a few large textures
+///
+/// Images are added at runtime and packed into pages with a SkylinePacker,
+/// when a page is full a new one is created.
+/// Sprites sharing a page share a texture, so they can be batched together.
+///
+/// Pages are uploaded by flush(), call it after adding images and before rendering.
+////////////////////////////////////////
+class TextureAtlas final : NonCopyable {
+public:
+    ////////////////////////////////////////
+    /// \brief Location of an image in the atlas
+    ////////////////////////////////////////
+    struct Region {
+        Texture* texture = nullptr; // Page texture
+        Rectf textureCoordinates;   // Texture coordinates of the image in the page
+        Vector2i size = {0, 0};     // Size of the image in pixels
+
+        inline bool valid() const { return texture; }
+
+        ////////////////////////////////////////
+        /// \brief Point a sprite made for the original image at the atlas
+        ///
+        /// Texture coordinates of the sprite are mapped from the whole image into the region
+        /// and its texture is set to the page.
+        ////////////////////////////////////////
+        void remap(Sprite& sprite) const;
+    };
+
+    TextureAtlas(const Vector2u& pageSize = {TEXTUREATLAS_DEFAULT_PAGE_SIZE,
+                                             TEXTUREATLAS_DEFAULT_PAGE_SIZE},
+                 Texture::Format format = Texture::Format_RGBA8_SRGB);
+
+    ////////////////////////////////////////
+    /// \brief Add an RGBA8 image
+    ////////////////////////////////////////
+    Region add(const Image& image);
+
+    ////////////////////////////////////////
+    /// \brief Add pixels in the format of the atlas
+    ///
+    /// Images larger than a page get their own page.
+    ///
+    /// \param pixelData Tightly packed rows of pixels
+    /// \param size Size in pixels
+    ////////////////////////////////////////
+    Region add(const uint8_t* pixelData, const Vector2u& size);
+
+    ////////////////////////////////////////
+    /// \brief Upload every page changed since the last flush
+    ////////////////////////////////////////
+    void flush();
+
+    ////////////////////////////////////////
+    /// \brief Remove every image and page
+    ///
+    /// Regions returned before are no longer valid.
+    ////////////////////////////////////////
+    void clear();
+
+    inline size_t page_count() const { return m_pages.size(); }
+    inline Texture::Format format() const { return m_format; }
+
+private:
+    struct Page {
+        Page(const Vector2u& size, Texture::Format format);
+
+        Texture texture;
+        std::vector<uint8_t> pixels; // Copy of the texture, uploaded whole by flush()
+        SkylinePacker packer;
+        bool dirty = true;
+    };
+
+    Region place(Page& page, const Vector2u& position, const uint8_t* pixelData,
+                 const Vector2u& size);
+
+    Vector2u m_pageSize;
+    Texture::Format m_format;
+
+    // Pages are never moved, regions point at their textures
+    std::vector<std::unique_ptr<Page>> m_pages;
+};
+
+////////////////////////////////////////
+/// \brief Create a sprite showing an atlas region at its pixel size
+////////////////////////////////////////
+ALWAYS_INLINE Sprite create_sprite(const TextureAtlas::Region& region,
+                                   const Vector4f& colour = {1.f, 1.f, 1.f, 1.f},
+                                   AnchorPoint anchor = AnchorPoint::TopLeft) {
+    Sprite sprite = create_sprite(region.size, region.textureCoordinates, colour, anchor);
+    sprite.texture = region.texture;
+    return sprite;
+}
+
+} // namespace Arclight
@@ -6,6 +6,7 @@
 namespace Arclight::Platform {
 
 bool _Access(const UnicodeString& path, int mode);
+bool _Exists(const UnicodeString& path);
 File* _OpenFile(const UnicodeString& path, int mode, Error* e = nullptr);
 
 } // namespace Arclight::Platform
@@ -27,6 +27,8 @@ typedef LONG_PTR ssize_t;
 #define ARCLIGHT_PLATFORM_WASM
 #endif
 
+#include <string>
+
 namespace Arclight::Platform {
 
 void Initialize();
@@ -34,4 +36,12 @@ void Cleanup();
 
 bool multithreading_enabled();
 
+// Per user directory for files which can be regenerated, such as the Vulkan pipeline cache.
+// Ends in a path separator and is created if missing, empty if there is none.
+std::string user_cache_directory();
+
+// Name of the game being run, safe to use in a file name.
+// Games are run from their own directory, which names them.
+std::string application_name();
+
 } // namespace Arclight::Platform
@@ -3,12 +3,37 @@
 #include <Arclight/ECS/System.h>
 #include <Arclight/ECS/World.h>
 
-#include <Arclight/Graphics/VertexBuffer.h>
+#include <Arclight/Graphics/Rendering/SpriteInstance.h>
+#include <Arclight/Graphics/Texture.h>
+#include <Arclight/Graphics/Vertex.h>
+
+#include <vector>
 
 namespace Arclight::Systems {
 
+// Vertices are streamed through Renderer::allocate_transient every frame
 struct Renderer2DContext {
-    VertexBuffer spriteVertexBuffer;
+    // Transform sprites and text on the CPU and draw each run of quads
+    // sharing a texture and z index with a single draw call.
+    // When false every quad is its own draw call.
+    bool batching = true;
+    // Draw batches with the instanced sprite path,
+    // each run of quads sharing a texture is one instanced draw call.
+    // With bindless textures only a change between sprites and SDF text breaks a run.
+    // Per vertex colours are not kept, each quad takes the colour of its first vertex.
+    bool instancing = false;
+
+    struct BatchQuad {
+        Texture::TextureHandle texture;
+        float zIndex;
+        bool sdf; // Signed distance field text
+    };
+
+    // Batching scratch space, kept between frames so it is not reallocated
+    std::vector<BatchQuad> batchQuads;
+    std::vector<Entity> batchEntities;
+    std::vector<size_t> batchTextOffsets; // First quad of each text object
+    std::vector<Rendering::SpriteInstance> batchInstances;
 };
 
 void renderer_2d(float elapsed, World& world);
@@ -0,0 +1,15 @@
+#pragma once
+
+#include <Arclight/ECS/World.h>
+
+namespace Arclight::Systems {
+
+////////////////////////////////////////
+/// \brief Rebuild the matrices of every PackedTransform2D changed since the last run
+///
+/// Add before renderer_2d, e.g.
+/// app.add_system<Systems::transform_2d, Application::Stage::PostTick>(Writes<PackedTransform2D>());
+////////////////////////////////////////
+void transform_2d(float elapsed, World& world);
+
+} // namespace Arclight::Systems
@@ -11,6 +11,9 @@
 
 //#define ARCLIGHT_STATE_DEBUG
 
+// Command source of tasks resumed by a stage, replayed after every system
+#define APPLICATION_STAGE_WAITER_SOURCE (uint64_t(UINT32_MAX) << 32)
+
 #ifdef ARCLIGHT_PLATFORM_WASM
 #include <emscripten.h>
 
@@ -35,9 +38,10 @@ Application::Application() {
 }
 
 void Application::run() {
-    for (auto& sys : m_globalSystems.init) {
-        m_threadPool.Schedule(*sys);
-    }
+    m_globalSystems.init.schedule(m_threadPool);
+
+    process_job_queue(Stage::Init);
+    World::s_currentWorld->cleanup();
 
     // A system may have queued a world or state change
     process_defer_queue();
@@ -91,30 +95,23 @@ void Application::main_loop() {
     m_input.Tick();
     pollEvents();
 
-    queue_system_group<Stage::PreTick>(m_globalSystems);
-    if (m_currentState) {
-        queue_system_group<Stage::PreTick>(*m_currentState);
-    }
-
+    // Draws are recorded without a lock, so render before any system of this frame can submit.
+    // Jobs of the previous frame finished at the PostTick barrier.
     Rendering::Renderer::instance()->render();
 
-    process_job_queue();
+    queue_systems<Stage::PreTick>();
+
+    process_job_queue(Stage::PreTick);
     World::s_currentWorld->cleanup();
 
-    queue_system_group<Stage::Tick>(m_globalSystems);
-    if (m_currentState) {
-        queue_system_group<Stage::Tick>(*m_currentState);
-    }
+    queue_systems<Stage::Tick>();
 
-    process_job_queue();
+    process_job_queue(Stage::Tick);
     World::s_currentWorld->cleanup();
 
-    queue_system_group<Stage::PostTick>(m_globalSystems);
-    if (m_currentState) {
-        queue_system_group<Stage::PostTick>(*m_currentState);
-    }
+    queue_systems<Stage::PostTick>();
 
-    process_job_queue();
+    process_job_queue(Stage::PostTick);
     World::s_currentWorld->cleanup();
     process_defer_queue();
 
@@ -144,15 +141,13 @@ void Application::exit() { m_isRunning = false; }
 
 void Application::run_state_init_systems() {
     if (m_currentState) {
-        for (auto& sys : m_currentState->init) {
-            sys->Init();
-            m_threadPool.Schedule(*sys);
-        }
+        m_currentState->init.init_systems();
+        m_currentState->init.schedule(m_threadPool);
 
         // Ensure any timers get reset
         init_system_group(*m_currentState);
 
-        process_job_queue();
+        process_job_queue(Stage::Init);
         World::s_currentWorld->cleanup();
         process_defer_queue();
     }
@@ -160,21 +155,54 @@ void Application::run_state_init_systems() {
 
 void Application::run_state_exit_systems() {
     if (m_currentState) {
-        for (auto& sys : m_currentState->exit) {
-            m_threadPool.Schedule(*sys);
-        }
+        m_currentState->exit.schedule(m_threadPool);
 
-        process_job_queue();
+        process_job_queue(Stage::Exit);
         World::s_currentWorld->cleanup();
         process_defer_queue();
     }
 }
 
-void Application::process_job_queue() {
-    m_threadPool.run();
+void Application::process_job_queue(Stage stage) {
+    // Runs jobs on the main thread then sleeps until the stage is complete
+    long waitTime = m_threadPool.wait_idle();
+
+    std::vector<Job*> waiters;
+    {
+        std::unique_lock lock(m_stageWaitersLock);
+        // Tasks awaiting the stage from now on wait for its next run
+        std::swap(waiters, m_stageWaiters[static_cast<int>(stage)]);
+        waiters.insert(waiters.end(), m_resumedTasks.begin(), m_resumedTasks.end());
+        m_resumedTasks.clear();
+    }
+
+    if (waiters.empty()) {
+        m_stageWaitTimes[static_cast<int>(stage)] = waitTime;
+        return;
+    }
+
+    // Tasks declare no access, resume them one at a time once the systems are done
+    // so they never run alongside a system or each other
+    for (size_t i = 0; i < waiters.size(); i++) {
+        CommandBuffer::SourceScope scope(APPLICATION_STAGE_WAITER_SOURCE | i);
+        waiters[i]->run();
+    }
+
+    // Finish any jobs the tasks started
+    waitTime += m_threadPool.wait_idle();
+    m_stageWaitTimes[static_cast<int>(stage)] = waitTime;
+}
+
+void Application::add_stage_waiter(Stage stage, Job& job) {
+    std::unique_lock lock(m_stageWaitersLock);
+    m_stageWaiters[static_cast<int>(stage)].push_back(&job);
+}
+
+void resume_task(Job& job) {
+    Application& app = Application::instance();
 
-    while (m_threadPool.job_count())
-        ; // We shouldn't really busy wait
+    std::unique_lock lock(app.m_stageWaitersLock);
+    app.m_resumedTasks.push_back(&job);
 }
 
 void Application::process_defer_queue() {
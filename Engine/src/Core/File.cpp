@@ -8,6 +8,10 @@ bool File::Access(const UnicodeString& path, int mode) {
     return Platform::_Access(path, mode);
 }
 
+bool File::Exists(const UnicodeString& path) {
+    return Platform::_Exists(path);
+}
+
 File* File::Open(const UnicodeString& path, int flags, Error* error) {
     return Platform::_OpenFile(path, flags, error);
 }
@@ -73,6 +73,16 @@ ResourceManager::ResourceManager() {
 }
 
 ResourceManager::~ResourceManager() {
+    if (m_loaderThread.joinable()) {
+        {
+            std::unique_lock lock(m_loaderLock);
+            m_loaderShouldDie = true;
+        }
+
+        m_loaderCondition.notify_one();
+        m_loaderThread.join();
+    }
+
     for(auto* f : m_formats){
         delete f;
     }
@@ -112,4 +122,40 @@ std::shared_ptr<Resource> ResourceManager::get_resource(const std::string& id) {
     return m_resources.at(id);
 }
 
+void ResourceManager::load_async(const std::string& id, LoadCallback callback) {
+    {
+        std::unique_lock lock(m_loaderLock);
+
+        if (!m_loaderThread.joinable()) {
+            m_loaderThread = std::thread(&ResourceManager::loader_main, this);
+        }
+
+        m_pendingLoads.push({id, std::move(callback)});
+    }
+
+    m_loaderCondition.notify_one();
+}
+
+void ResourceManager::loader_main() {
+    while (true) {
+        PendingLoad load;
+        {
+            std::unique_lock lock(m_loaderLock);
+            m_loaderCondition.wait(lock, [this]() -> bool {
+                return !m_pendingLoads.empty() || m_loaderShouldDie;
+            });
+
+            if (m_pendingLoads.empty()) {
+                return;
+            }
+
+            load = std::move(m_pendingLoads.front());
+            m_pendingLoads.pop();
+        }
+
+        // Blocking I/O happens here rather than on a ThreadPool worker
+        load.callback(get_resource(load.id));
+    }
+}
+
 } // namespace Arclight
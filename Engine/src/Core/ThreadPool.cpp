@@ -4,32 +4,53 @@
 #include <Arclight/Core/Logger.h>
 #include <Arclight/Platform/Platform.h>
 
+#include <chrono>
 #include <cstdlib>
 
+// Failed find_job attempts before a worker goes to sleep
+#define THREADPOOL_SPIN_COUNT 64
+
 namespace Arclight {
 
 ThreadPool* ThreadPool::m_instance = nullptr;
+thread_local int ThreadPool::s_threadIndex = -1;
+
+void ThreadMain(ThreadPool* pool, int index) {
+    ThreadPool::s_threadIndex = index;
+
+    int spins = 0;
+    while (!pool->m_threadsShouldDie.load(std::memory_order_acquire)) {
+        Job* job = pool->find_job(index);
+        if (job) {
+            pool->execute(job);
+            spins = 0;
+            continue;
+        }
 
-void ThreadMain(ThreadPool* pool) {
-    Arclight::Job* currentJob = nullptr;
-    while (!pool->m_threadsShouldDie) {
-        {
-            std::unique_lock<std::mutex> acquiredLock(pool->m_queueMutex);
-            pool->m_condition.wait(acquiredLock, [pool]() -> bool {
-                return !pool->m_jobs.empty() || pool->m_threadsShouldDie;
-            }); // Wait for jobs
+        if (spins++ < THREADPOOL_SPIN_COUNT) {
+            std::this_thread::yield();
+            continue;
+        }
 
-            if (pool->m_jobs.empty()) {
-                continue;
-            }
+        // Read the epoch before the final check,
+        // anything scheduled after this will bump it and wake us
+        uint32_t epoch = pool->m_wakeEpoch.load(std::memory_order_acquire);
+        pool->m_sleepingThreads.fetch_add(1, std::memory_order_seq_cst);
+
+        job = pool->find_job(index);
+        if (job) {
+            pool->m_sleepingThreads.fetch_sub(1, std::memory_order_relaxed);
+            pool->execute(job);
+            spins = 0;
+            continue;
+        }
 
-            currentJob = pool->m_jobs.front();
-            pool->m_jobs.pop();
+        if (!pool->m_threadsShouldDie.load(std::memory_order_acquire)) {
+            pool->m_wakeEpoch.wait(epoch, std::memory_order_acquire);
         }
 
-        // Ensure we release lock before job is run
-        currentJob->run();
-        pool->m_jobCount--;
+        pool->m_sleepingThreads.fetch_sub(1, std::memory_order_relaxed);
+        spins = 0;
     }
 }
 
@@ -51,8 +72,16 @@ ThreadPool::ThreadPool() {
 
     Logger::Debug("[ThreadPool] Using {} threads.", cpuCount);
 
-    while (cpuCount--) {
-        m_threads.push_back(std::thread(ThreadMain, this));
+    // Deques must exist before any worker starts stealing
+    for (long i = 0; i <= cpuCount; i++) {
+        m_queues.push_back(std::make_unique<WorkStealingQueue<Job*>>());
+    }
+
+    // The creating thread (usually the main thread) owns the last deque
+    s_threadIndex = static_cast<int>(cpuCount);
+
+    for (long i = 0; i < cpuCount; i++) {
+        m_threads.push_back(std::thread(ThreadMain, this, static_cast<int>(i)));
     }
 
     m_instance = this;
@@ -63,45 +92,164 @@ ThreadPool::~ThreadPool() {
         m_instance = nullptr;
     }
 
-    m_threadsShouldDie = true;
+    m_threadsShouldDie.store(true, std::memory_order_release);
 
-    m_condition.notify_all();
+    m_wakeEpoch.fetch_add(1, std::memory_order_release);
+    m_wakeEpoch.notify_all();
+    m_idleEpoch.fetch_add(1, std::memory_order_release);
+    m_idleEpoch.notify_all();
     for (auto& thread : m_threads) {
         thread.join();
     }
+
+    s_threadIndex = -1;
 }
 
 void ThreadPool::Schedule(Job& job) {
-    m_queueMutex.lock();
+    m_jobCount.fetch_add(1, std::memory_order_relaxed);
 
-    m_jobCount++;
+    int index = s_threadIndex;
+    if (index >= 0 && index < static_cast<int>(m_queues.size())) {
+        m_queues[index]->push(&job);
+    } else {
+        std::scoped_lock lock(m_injectedMutex);
 
-    m_jobs.push(&job);        // Push job to queue
-    m_condition.notify_one(); // Wake up a thread
+        m_injectedJobs.push(&job);
+        m_injectedCount.fetch_add(1, std::memory_order_release);
+    }
+
+    // Pairs with the sleeping counter increment in ThreadMain
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (m_sleepingThreads.load(std::memory_order_relaxed)) {
+        m_wakeEpoch.fetch_add(1, std::memory_order_release);
+        m_wakeEpoch.notify_one(); // Wake up a thread
+    }
 
-    m_queueMutex.unlock();
+    // Threads blocked in wait_idle() help with newly queued jobs
+    if (m_idleWaiters.load(std::memory_order_relaxed)) {
+        m_idleEpoch.fetch_add(1, std::memory_order_release);
+        m_idleEpoch.notify_all();
+    }
 }
 
 void ThreadPool::run() {
-    Arclight::Job* currentJob = nullptr;
-    while (!m_threadsShouldDie && !m_jobs.empty()) {
-        {
-            std::unique_lock<std::mutex> acquiredLock(m_queueMutex);
+    int index = s_threadIndex;
+    while (!m_threadsShouldDie.load(std::memory_order_acquire)) {
+        Job* job = find_job(index);
+        if (!job) {
+            break;
+        }
+
+        execute(job);
+    }
+}
+
+long ThreadPool::wait_idle() {
+    long blockedUs = 0;
+    while (true) {
+        run();
+
+        uint32_t epoch = m_idleEpoch.load(std::memory_order_acquire);
+        m_idleWaiters.fetch_add(1, std::memory_order_seq_cst);
+
+        if (!m_jobCount.load(std::memory_order_seq_cst)) {
+            m_idleWaiters.fetch_sub(1, std::memory_order_relaxed);
+            return blockedUs;
+        }
+
+        // Jobs are still running on other threads,
+        // sleep until the last one finishes or more work is queued
+        auto start = std::chrono::steady_clock::now();
+        m_idleEpoch.wait(epoch, std::memory_order_acquire);
+        blockedUs += std::chrono::duration_cast<std::chrono::microseconds>(
+                         std::chrono::steady_clock::now() - start)
+                         .count();
+
+        m_idleWaiters.fetch_sub(1, std::memory_order_relaxed);
+    }
+}
 
-            if (m_jobs.empty()) {
+void ThreadPool::wait_for(std::atomic<unsigned>& counter) {
+    int index = s_threadIndex;
+
+    unsigned value;
+    while ((value = counter.load(std::memory_order_acquire))) {
+        if (Job* job = find_job(index)) {
+            execute(job);
+            continue;
+        }
+
+        // Nothing left to steal, remaining children are running on other threads
+        counter.wait(value, std::memory_order_acquire);
+    }
+}
+
+bool ThreadPool::Idle() const { return !job_count(); }
+
+Job* ThreadPool::find_job(int index) {
+    if (index >= 0) {
+        if (Job* job = m_queues[index]->pop()) {
+            return job;
+        }
+    }
+
+    if (m_injectedCount.load(std::memory_order_acquire)) {
+        std::scoped_lock lock(m_injectedMutex);
+
+        if (!m_injectedJobs.empty()) {
+            Job* job = m_injectedJobs.front();
+            m_injectedJobs.pop();
+            m_injectedCount.fetch_sub(1, std::memory_order_relaxed);
+            return job;
+        }
+    }
+
+    return steal_job(index);
+}
+
+Job* ThreadPool::steal_job(int index) {
+    // Cheap per-thread xorshift so thieves do not all start at the same victim
+    thread_local uint32_t seed = static_cast<uint32_t>(index + 1) * 2654435761u;
+
+    const unsigned queueCount = m_queues.size();
+    bool contended;
+    do {
+        contended = false;
+
+        seed ^= seed << 13;
+        seed ^= seed >> 17;
+        seed ^= seed << 5;
+
+        unsigned start = seed % queueCount;
+        for (unsigned i = 0; i < queueCount; i++) {
+            unsigned victim = (start + i) % queueCount;
+            if (static_cast<int>(victim) == index) {
                 continue;
             }
 
-            currentJob = m_jobs.front();
-            m_jobs.pop();
+            WorkStealingQueue<Job*>& queue = *m_queues[victim];
+            if (Job* job = queue.steal()) {
+                return job;
+            }
+
+            // Lost a race against another thief or the owner, try again
+            if (!queue.empty()) {
+                contended = true;
+            }
         }
+    } while (contended);
 
-        // Ensure we release lock before job is run
-        currentJob->run();
-        m_jobCount--;
-    }
+    return nullptr;
 }
 
-bool ThreadPool::Idle() const { return !m_jobCount; }
+void ThreadPool::execute(Job* job) {
+    job->run();
+
+    if (m_jobCount.fetch_sub(1, std::memory_order_seq_cst) == 1 &&
+        m_idleWaiters.load(std::memory_order_seq_cst)) {
+        m_idleEpoch.fetch_add(1, std::memory_order_release);
+        m_idleEpoch.notify_all();
+    }
+}
 
 } // namespace Arclight
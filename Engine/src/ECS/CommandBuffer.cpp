@@ -0,0 +1,64 @@
+#include <Arclight/ECS/CommandBuffer.h>
+
+#include <algorithm>
+#include <cassert>
+
+// Payload block size in bytes, larger payloads get a block of their own
+#define COMMANDBUFFER_BLOCK_SIZE 16384
+
+namespace Arclight {
+
+thread_local uint64_t CommandBuffer::s_source = 0;
+
+CommandBuffer::~CommandBuffer() {
+    // Commands which were never replayed still own their payloads
+    for (const Command& command : m_commands) {
+        if (command.destroy) {
+            command.destroy(command.payload);
+        }
+    }
+}
+
+PendingEntity CommandBuffer::create() {
+    PendingEntity entity = {this, m_pendingCount++};
+    push(Op::Create, Target{NullEntity, this, entity.index});
+
+    return entity;
+}
+
+void CommandBuffer::destroy(Entity entity) { push(Op::Destroy, Target{entity, nullptr, 0}); }
+
+void* CommandBuffer::allocate(size_t size, size_t alignment) {
+    assert(alignment <= alignof(std::max_align_t));
+
+    while (m_currentBlock < m_blocks.size()) {
+        Block& block = m_blocks[m_currentBlock];
+
+        size_t offset = (block.used + alignment - 1) & ~(alignment - 1);
+        if (offset + size <= block.size) {
+            block.used = offset + size;
+            return block.data.get() + offset;
+        }
+
+        m_currentBlock++;
+    }
+
+    size_t blockSize = std::max<size_t>(size, COMMANDBUFFER_BLOCK_SIZE);
+    m_blocks.push_back({std::make_unique<std::byte[]>(blockSize), blockSize, size});
+    m_currentBlock = m_blocks.size() - 1;
+
+    return m_blocks.back().data.get();
+}
+
+void CommandBuffer::reset() {
+    m_commands.clear();
+    m_sequence = 0;
+    m_pendingCount = 0;
+
+    for (Block& block : m_blocks) {
+        block.used = 0;
+    }
+    m_currentBlock = 0;
+}
+
+} // namespace Arclight
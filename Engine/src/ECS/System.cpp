@@ -0,0 +1,125 @@
+#include <Arclight/ECS/System.h>
+
+#include <Arclight/Core/ThreadPool.h>
+
+#include <atomic>
+
+namespace Arclight {
+
+// Systems are numbered in the order they were added, across all stages
+static std::atomic<uint32_t> s_nextSystemID = 1;
+
+void SystemStage::add(std::unique_ptr<Job> system, SystemAccess access) {
+    auto node = std::make_unique<Node>();
+    node->system = std::move(system);
+    node->access = std::move(access);
+    node->source = uint64_t(s_nextSystemID.fetch_add(1, std::memory_order_relaxed)) << 32;
+
+    // Earlier systems always run first, this keeps the graph acyclic
+    // and the order of conflicting systems deterministic
+    for (auto& other : m_nodes) {
+        if (node->access.conflicts(other->access)) {
+            other->dependents.push_back(node.get());
+            node->dependencyCount++;
+        }
+    }
+
+    if (!node->dependencyCount) {
+        m_roots.push_back(node.get());
+    }
+
+    m_nodes.push_back(std::move(node));
+}
+
+void SystemStage::schedule(ThreadPool& pool, SystemStage* next) {
+    // Systems may have been added since the stages were linked
+    if (next != m_next ||
+        (next && m_linkedNodeCount != m_nodes.size() + next->m_nodes.size())) {
+        link(next);
+    }
+
+    // Reset every node before any is scheduled, they may finish immediately
+    for (auto& node : m_nodes) {
+        node->pool = &pool;
+        node->remaining.store(node->dependencyCount, std::memory_order_relaxed);
+    }
+
+    if (next) {
+        for (auto& node : next->m_nodes) {
+            node->pool = &pool;
+            node->remaining.store(node->dependencyCount + node->linkedDependencyCount,
+                                  std::memory_order_relaxed);
+        }
+    }
+
+    for (Node* node : m_roots) {
+        pool.Schedule(*node);
+    }
+
+    if (next) {
+        for (Node* node : next->m_roots) {
+            if (!node->linkedDependencyCount) {
+                pool.Schedule(*node);
+            }
+        }
+    }
+}
+
+void SystemStage::link(SystemStage* next) {
+    for (auto& node : m_nodes) {
+        node->linkedDependents.clear();
+    }
+
+    if (m_next) {
+        for (auto& node : m_next->m_nodes) {
+            node->linkedDependencyCount = 0;
+        }
+    }
+
+    m_next = next;
+    if (!next) {
+        m_linkedNodeCount = 0;
+        return;
+    }
+
+    for (auto& node : next->m_nodes) {
+        for (auto& other : m_nodes) {
+            if (node->access.conflicts(other->access)) {
+                other->linkedDependents.push_back(node.get());
+                node->linkedDependencyCount++;
+            }
+        }
+    }
+
+    m_linkedNodeCount = m_nodes.size() + next->m_nodes.size();
+}
+
+void SystemStage::init_systems() {
+    for (auto& node : m_nodes) {
+        node->system->Init();
+    }
+}
+
+void SystemStage::Node::run() {
+    {
+        CommandBuffer::SourceScope scope(source);
+        // Systems which declare their access may run alongside others
+        World::SharedScope shared(!access.exclusive());
+        system->run();
+    }
+
+    // Scheduled before this job finishes so the ThreadPool never appears idle mid stage
+    for (Node* dependent : dependents) {
+        if (dependent->remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            pool->Schedule(*dependent);
+        }
+    }
+
+    for (Node* dependent : linkedDependents) {
+        if (dependent->remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            pool->Schedule(*dependent);
+        }
+    }
+}
+
+} // namespace Arclight
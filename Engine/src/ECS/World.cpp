@@ -1,18 +1,190 @@
 #include <Arclight/ECS/World.h>
 
+#include <algorithm>
+#include <atomic>
+
 namespace Arclight {
 
 World* World::s_currentWorld = nullptr;
 
+static std::atomic<uint64_t> s_nextWorldID = 1;
+
+// Thread local data cannot be part of an exported class
+static thread_local bool s_sharedScope = false;
+
+World::SharedScope::SharedScope(bool shared) : m_previous(s_sharedScope) {
+    s_sharedScope = m_previous || shared;
+}
+
+World::SharedScope::~SharedScope() { s_sharedScope = m_previous; }
+
+bool World::in_shared_scope() { return s_sharedScope; }
+
+World::World() : m_id(s_nextWorldID.fetch_add(1, std::memory_order_relaxed)) {}
+
+World::~World() = default;
+
 void World::cleanup() {
-    for(void(World::*func)() : m_componentCleanupFunctions){
-        (this->*func)();
+    flush_commands();
+
+    if (m_pendingComponentCleanups) {
+        run_component_cleanups();
     }
 
-    // Remove all tagged entities
+    if (m_pendingDestroyCount) {
+        destroy_tagged_entities();
+    }
+}
+
+void World::run_component_cleanups() {
+    m_parallelCleanups.clear();
+
+    for (ComponentCleanup& cleanup : m_componentCleanupFunctions) {
+        if (!cleanup.pending) {
+            continue;
+        }
+
+        cleanup.pending = false;
+        if ((this->*cleanup.prepare)()) {
+            m_parallelCleanups.push_back(cleanup.remove);
+        } else {
+            (this->*cleanup.remove)();
+        }
+    }
+
+    m_pendingComponentCleanups = 0;
+
+    // Each pass only touches the pools of its own component, which exist by now
+    parallel_for(m_parallelCleanups.size(), 1, [this](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            (this->*m_parallelCleanups[i])();
+        }
+    });
+}
+
+void World::destroy_tagged_entities() {
     auto view = m_registry.view<const Components::RemovalTag>();
-    for (Entity entity : view) {
-        m_registry.destroy(entity);
+    m_destroyQueue.assign(view.begin(), view.end());
+
+    // Sweep each pool once rather than every pool once per entity
+    for (auto [id, pool] : m_registry.storage()) {
+        pool.remove(m_destroyQueue.begin(), m_destroyQueue.end());
+    }
+
+    m_registry.release(m_destroyQueue.begin(), m_destroyQueue.end());
+    m_pendingDestroyCount = 0;
+}
+
+CommandBuffer& World::commands() {
+    // Most threads only ever record into one world
+    thread_local uint64_t cachedWorld = 0;
+    thread_local CommandBuffer* cachedBuffer = nullptr;
+
+    if (cachedWorld == m_id) {
+        return *cachedBuffer;
+    }
+
+    std::unique_lock lock(m_commandBuffersMutex);
+
+    const std::thread::id thread = std::this_thread::get_id();
+    auto it = std::find_if(m_commandBuffers.begin(), m_commandBuffers.end(),
+                           [thread](const auto& entry) { return entry.first == thread; });
+
+    if (it == m_commandBuffers.end()) {
+        m_commandBuffers.emplace_back(thread, std::make_unique<CommandBuffer>());
+        it = m_commandBuffers.end() - 1;
+    }
+
+    cachedWorld = m_id;
+    cachedBuffer = it->second.get();
+    return *cachedBuffer;
+}
+
+void World::flush_commands() {
+    struct Entry {
+        uint64_t source;
+        uint32_t buffer;
+        uint32_t sequence;
+        const CommandBuffer::Command* command;
+    };
+
+    // Only touched by cleanup(), keep the allocation between frames
+    thread_local std::vector<Entry> entries;
+    entries.clear();
+
+    for (uint32_t i = 0; i < m_commandBuffers.size(); i++) {
+        for (const auto& command : m_commandBuffers[i].second->m_commands) {
+            entries.push_back({command.source, i, command.sequence, &command});
+        }
+    }
+
+    if (entries.empty()) {
+        return;
+    }
+
+    // Threads run whichever systems they pick up, order by the recording system instead
+    std::sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) {
+        if (a.source != b.source) {
+            return a.source < b.source;
+        }
+
+        if (a.buffer != b.buffer) {
+            return a.buffer < b.buffer;
+        }
+
+        return a.sequence < b.sequence;
+    });
+
+    for (auto& [thread, buffer] : m_commandBuffers) {
+        buffer->m_created.assign(buffer->m_pendingCount, NullEntity);
+    }
+
+    // Create entities first so any command can refer to a pending entity
+    for (const Entry& entry : entries) {
+        const auto& command = *entry.command;
+        if (command.op == CommandBuffer::Op::Create) {
+            command.target.buffer->m_created[command.target.pending] = m_registry.create();
+        }
+    }
+
+    for (const Entry& entry : entries) {
+        const auto& command = *entry.command;
+        if (command.op == CommandBuffer::Op::Create) {
+            continue;
+        }
+
+        Entity entity = command.target.entity;
+        if (command.target.buffer) {
+            entity = command.target.buffer->m_created[command.target.pending];
+        }
+
+        if (!m_registry.valid(entity)) {
+            if (command.destroy) {
+                command.destroy(command.payload);
+            }
+
+            continue;
+        }
+
+        switch (command.op) {
+        case CommandBuffer::Op::Destroy:
+            m_registry.emplace_or_replace<Components::RemovalTag>(entity);
+            m_pendingDestroyCount++;
+            break;
+        case CommandBuffer::Op::Emplace:
+            command.apply(*this, entity, command.payload);
+            command.destroy(command.payload);
+            break;
+        case CommandBuffer::Op::Remove:
+            command.apply(*this, entity, nullptr);
+            break;
+        default:
+            break;
+        }
+    }
+
+    for (auto& [thread, buffer] : m_commandBuffers) {
+        buffer->reset();
     }
 }
 
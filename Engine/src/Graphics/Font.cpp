@@ -1,58 +1,200 @@
 #include <Arclight/Graphics/Font.h>
 
+#include <algorithm>
+#include <atomic>
 #include <cassert>
+#include <thread>
 
 #include <Arclight/Core/Fatal.h>
 #include <Arclight/Core/File.h>
 #include <Arclight/Core/Logger.h>
 #include <Arclight/Core/UnicodeString.h>
+#include <Arclight/Graphics/GlyphCache.h>
 
 #include "Freetype.h"
 
-namespace Arclight {
+FreeType* FreeType::m_instance = new FreeType();
 
-Font::Font() : Resource() {}
+FreeType::FreeType() {
+    assert(!m_instance);
+    m_instance = this;
+}
 
-Font::~Font() {
-    if (m_handle) {
-        FT_Error e = FreeType::instance().DoneFace(reinterpret_cast<FT_Face>(m_handle));
-        assert(!e);
+FreeType::Library& FreeType::library() {
+    thread_local Library* cachedLibrary = nullptr;
+    if (cachedLibrary) {
+        return *cachedLibrary;
+    }
+
+    auto library = std::make_unique<Library>();
+
+    Arclight::Logger::Debug("Initializing Freetype!");
+
+    if (FT_Error e = FT_Init_FreeType(&library->library); e) {
+        Arclight::Logger::Error("Error {} initializing freetype!", FT_Error_String(e));
+        FatalRuntimeError("Failed to initialize Freetype!");
     }
+
+    // The default spread of 2 leaves too little room to scale SDF glyphs down
+    FT_Int spread = FREETYPE_SDF_SPREAD;
+    FT_Property_Set(library->library, "sdf", "spread", &spread);
+    FT_Property_Set(library->library, "bsdf", "spread", &spread);
+
+    std::scoped_lock lock(m_librariesLock);
+    cachedLibrary = m_libraries.emplace_back(std::move(library)).get();
+    return *cachedLibrary;
+}
+
+FT_Error FreeType::NewFace(Library& library, const std::vector<uint8_t>& data, FT_Long index,
+                           FT_Face* outFace) {
+    std::scoped_lock lock(library.lock);
+
+    return FT_New_Memory_Face(library.library, data.data(), static_cast<FT_Long>(data.size()),
+                              index, outFace);
+}
+
+FT_Error FreeType::DoneFace(Library& library, FT_Face face) {
+    std::scoped_lock lock(library.lock);
+
+    return FT_Done_Face(face);
 }
 
+namespace Arclight {
+
+static std::atomic<uint64_t> s_nextFontID = 1;
+
+Font::Font() : Resource(), m_id(s_nextFontID.fetch_add(1, std::memory_order_relaxed)) {}
+
+Font::~Font() { release_faces(); }
+
 int Font::Load() { return LoadImpl(); }
 
+GlyphCache& Font::glyph_cache(int pixelSize) {
+    std::scoped_lock lock(m_glyphCacheLock);
+
+    if (m_renderMode == RenderSDF) {
+        // One cache serves every size
+        pixelSize = FONT_SDF_PIXEL_SIZE;
+    }
+
+    auto& cache = m_glyphCaches[pixelSize];
+    if (!cache) {
+        cache = std::make_unique<GlyphCache>(*this, pixelSize, m_renderMode == RenderSDF);
+    }
+
+    return *cache;
+}
+
+void Font::set_render_mode(RenderMode mode) {
+    std::scoped_lock lock(m_glyphCacheLock);
+    if (mode == m_renderMode) {
+        return;
+    }
+
+    m_renderMode = mode;
+    m_glyphCaches.clear();
+}
+
 int Font::LoadImpl() {
-    if (m_handle) {
-        FT_Error e = FreeType::instance().DoneFace(reinterpret_cast<FT_Face>(m_handle));
-        assert(!e);
+    {
+        std::scoped_lock lock(m_facesLock);
+        // Glyph caches and faces of a loaded font may be in use on any thread
+        if (!m_faces.empty()) {
+            return 0;
+        }
     }
 
+    m_fontData.clear();
+
     File* file = File::Open(m_filesystemPath);
     if (!file) {
         Logger::Error("Error opening font face '{}'.", m_filesystemPath);
-
-        m_handle = nullptr;
         return -1;
     }
 
-    FT_Error e =
-        FreeType::instance().NewFace(file, 0, reinterpret_cast<FT_Face*>(&m_handle), m_fontData);
+    // Every thread creates its face from this copy
+    size_t size = file->get_size();
+    m_fontData.resize(size);
+    bool failed = file->Read(m_fontData.data(), size) < 0;
     delete file;
 
-    if (e) {
+    if (failed) {
+        Logger::Error("Error reading font face '{}'", m_filesystemPath);
+
+        m_fontData.clear();
+        return FT_Err_Cannot_Open_Resource;
+    }
+
+    // Check the font loads with this thread's face
+    FT_Error e = FT_Err_Ok;
+    if (!thread_face(&e)) {
         Logger::Error("Error {} loading font face '{}'", e, m_filesystemPath);
 
-        m_handle = nullptr;
+        m_fontData.clear();
         return e;
     }
 
-    FT_Face face = reinterpret_cast<FT_Face>(m_handle);
-    e = FT_Select_Charmap(face, FT_ENCODING_UNICODE);
-    assert(!e);
-
-    assert(m_handle);
     return 0;
 }
 
+Font::ThreadFace* Font::thread_face(int* error) {
+    // Most threads only ever use one font at a time
+    thread_local uint64_t cachedFont = 0;
+    thread_local ThreadFace* cachedFace = nullptr;
+
+    const uint64_t id = m_id.load(std::memory_order_acquire);
+    if (cachedFont == id) {
+        return cachedFace;
+    }
+
+    if (m_fontData.empty()) {
+        return nullptr;
+    }
+
+    std::unique_lock lock(m_facesLock);
+
+    const std::thread::id thread = std::this_thread::get_id();
+    auto it = std::find_if(m_faces.begin(), m_faces.end(),
+                           [thread](const auto& face) { return face->thread == thread; });
+
+    if (it == m_faces.end()) {
+        FreeType::Library& library = FreeType::instance().library();
+
+        FT_Face face;
+        FT_Error e = FreeType::instance().NewFace(library, m_fontData, 0, &face);
+        if (e) {
+            if (error) {
+                *error = e;
+            }
+            return nullptr;
+        }
+
+        e = FT_Select_Charmap(face, FT_ENCODING_UNICODE);
+        assert(!e);
+
+        m_faces.push_back(std::make_unique<ThreadFace>(ThreadFace{thread, &library, face}));
+        it = m_faces.end() - 1;
+    }
+
+    cachedFont = id;
+    cachedFace = it->get();
+    return cachedFace;
+}
+
+void Font::release_faces() {
+    std::unique_lock lock(m_facesLock);
+
+    // Threads still caching the old faces look them up again
+    m_id.store(s_nextFontID.fetch_add(1, std::memory_order_relaxed), std::memory_order_release);
+
+    for (auto& face : m_faces) {
+        FT_Error e =
+            FreeType::instance().DoneFace(*reinterpret_cast<FreeType::Library*>(face->library),
+                                          reinterpret_cast<FT_Face>(face->face));
+        assert(!e);
+        (void)e;
+    }
+    m_faces.clear();
+}
+
 } // namespace Arclight
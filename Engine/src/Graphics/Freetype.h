@@ -1,9 +1,14 @@
 #pragma once
 
+#include <Arclight/Core/File.h>
 #include <Arclight/Platform/Platform.h>
 
 #include <ft2build.h>
 #include FT_FREETYPE_H
+#include FT_MODULE_H
+
+// Distance in pixels covered by signed distance field glyphs either side of the outline
+#define FREETYPE_SDF_SPREAD 8
 
 #ifdef ARCLIGHT_PLATFORM_WASM
 #define FT_Error_String(s) ((const char*)(""))
@@ -12,11 +17,24 @@
 // Private wrapper class for FreeType
 
 #include <cassert>
+#include <memory>
 #include <mutex>
 #include <vector>
 
 class FreeType {
 public:
+    ////////////////////////////////////////
+    /// \brief FT_Library of one thread
+    ///
+    /// A library and its faces must only be used by one thread at a time.
+    /// Every thread rasterises with its own library so fonts scale across threads,
+    /// lock is only contended when another thread frees a face of the library.
+    ////////////////////////////////////////
+    struct Library {
+        FT_Library library = nullptr;
+        std::mutex lock;
+    };
+
     FreeType();
 
     static inline FreeType& instance() {
@@ -24,13 +42,18 @@ public:
         return *m_instance;
     }
 
-    // Thread-safe wrapper functions for FreeType
-    FT_Error NewFace(class Arclight::File* file, FT_Long index, FT_Face* outFace, std::vector<uint8_t>& outData);
-    FT_Error DoneFace(FT_Face face);
+    // Library of the calling thread, created on first use
+    Library& library();
+
+    // Both lock the library, faces can be freed from any thread
+    FT_Error NewFace(Library& library, const std::vector<uint8_t>& data, FT_Long index,
+                     FT_Face* outFace);
+    FT_Error DoneFace(Library& library, FT_Face face);
 
 private:
     static FreeType* m_instance;
 
-    std::mutex m_lock;
-    FT_Library m_library = nullptr;
+    // Libraries are kept until exit, faces of a thread may outlive it
+    std::mutex m_librariesLock;
+    std::vector<std::unique_ptr<Library>> m_libraries;
 };
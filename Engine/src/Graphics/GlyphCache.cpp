@@ -0,0 +1,151 @@
+#include <Arclight/Graphics/GlyphCache.h>
+
+#include <Arclight/Core/Logger.h>
+#include <Arclight/Graphics/Font.h>
+
+#include "Freetype.h"
+
+#include <cstring>
+#include <vector>
+
+namespace Arclight {
+
+class GlyphCache::FaceLock final {
+public:
+    FaceLock(Font& font, int pixelSize) {
+        Font::ThreadFace* threadFace = font.thread_face();
+        if (!threadFace) {
+            return;
+        }
+
+        m_lock = std::unique_lock(reinterpret_cast<FreeType::Library*>(threadFace->library)->lock);
+        FT_Face face = reinterpret_cast<FT_Face>(threadFace->face);
+
+        // Caches of other sizes share the face
+        if (FT_Set_Pixel_Sizes(face, 0, pixelSize)) {
+            Logger::Error("GlyphCache: Failed to set font size {}!", pixelSize);
+            return;
+        }
+
+        m_face = face;
+    }
+
+    // nullptr if the font is not loaded
+    inline FT_Face face() const { return m_face; }
+
+private:
+    std::unique_lock<std::mutex> m_lock;
+    FT_Face m_face = nullptr;
+};
+
+GlyphCache::GlyphCache(Font& font, int pixelSize, bool sdf)
+    : m_font(font), m_pixelSize(pixelSize), m_sdf(sdf),
+      m_atlas({GLYPHCACHE_PAGE_SIZE, GLYPHCACHE_PAGE_SIZE}, Texture::Format_A8_SRGB) {
+    FaceLock faceLock(m_font, m_pixelSize);
+    FT_Face face = faceLock.face();
+    if (!face) {
+        return;
+    }
+
+    // In 64ths of a pixel so r shift by 6
+    m_lineHeight = face->size->metrics.height >> 6;
+    m_ascender = face->size->metrics.ascender >> 6;
+    m_hasKerning = FT_HAS_KERNING(face);
+}
+
+GlyphCache::Glyph GlyphCache::glyph(uint32_t codepoint) {
+    {
+        std::scoped_lock lock(m_lock);
+
+        auto it = m_glyphs.find(codepoint);
+        if (it != m_glyphs.end()) {
+            return it->second;
+        }
+    }
+
+    Bitmap bitmap = rasterise(codepoint);
+
+    std::scoped_lock lock(m_lock);
+    // Another thread may have rasterised the glyph in the meantime
+    auto [it, inserted] = m_glyphs.try_emplace(codepoint, bitmap.glyph);
+    if (inserted && !bitmap.pixels.empty()) {
+        it->second.region = m_atlas.add(bitmap.pixels.data(), bitmap.size);
+    }
+
+    return it->second;
+}
+
+int GlyphCache::kerning(uint32_t left, uint32_t right) {
+    if (!m_hasKerning || !left || !right) {
+        return 0;
+    }
+
+    const uint64_t pair = (static_cast<uint64_t>(left) << 32) | right;
+
+    {
+        std::scoped_lock lock(m_lock);
+        auto it = m_kerning.find(pair);
+        if (it != m_kerning.end()) {
+            return it->second;
+        }
+    }
+
+    FT_Vector kerning = {0, 0};
+    {
+        FaceLock faceLock(m_font, m_pixelSize);
+        if (FT_Face face = faceLock.face()) {
+            FT_Get_Kerning(face, left, right, FT_KERNING_DEFAULT, &kerning);
+        }
+    }
+
+    std::scoped_lock lock(m_lock);
+    return m_kerning[pair] = static_cast<int>(kerning.x >> 6);
+}
+
+void GlyphCache::flush() {
+    std::scoped_lock lock(m_lock);
+    m_atlas.flush();
+}
+
+GlyphCache::Bitmap GlyphCache::rasterise(uint32_t codepoint) {
+    Bitmap result;
+    Glyph& glyph = result.glyph;
+
+    FaceLock faceLock(m_font, m_pixelSize);
+    FT_Face face = faceLock.face();
+    if (!face) {
+        return result;
+    }
+
+    glyph.index = FT_Get_Char_Index(face, codepoint);
+    if (m_sdf) {
+        // Hinting is for one pixel size, SDF glyphs are scaled to any size
+        if (FT_Load_Glyph(face, glyph.index, FT_LOAD_NO_HINTING) ||
+            FT_Render_Glyph(face->glyph, FT_RENDER_MODE_SDF)) {
+            return result;
+        }
+    } else if (FT_Load_Glyph(face, glyph.index, FT_LOAD_RENDER)) {
+        return result;
+    }
+
+    // Bitmaps of SDF glyphs are larger by the spread, the bearing accounts for it
+    FT_GlyphSlot slot = face->glyph;
+    glyph.bearing = {slot->bitmap_left, slot->bitmap_top};
+    glyph.advance = static_cast<int>(slot->advance.x >> 6);
+
+    const FT_Bitmap& bitmap = slot->bitmap;
+    if (!bitmap.width || !bitmap.rows) {
+        return result;
+    }
+
+    // The atlas takes tightly packed rows, the bitmap pitch may be wider
+    result.size = {bitmap.width, bitmap.rows};
+    result.pixels.resize(bitmap.width * bitmap.rows);
+    for (unsigned y = 0; y < bitmap.rows; y++) {
+        memcpy(&result.pixels[y * bitmap.width], &bitmap.buffer[y * bitmap.pitch], bitmap.width);
+    }
+
+    return result;
+}
+
+} // namespace Arclight
@@ -0,0 +1,338 @@
+#include <Arclight/Graphics/PackedTransform2D.h>
+
+#include <Arclight/Core/Fatal.h>
+#include <Arclight/Core/ParallelFor.h>
+
+#include <utility>
+
+#define _USE_MATH_DEFINES
+#include <math.h>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64)
+#define TRANSFORM_KERNEL_SSE
+#include <immintrin.h>
+// AVX is picked at runtime, the engine is not built with -mavx
+#if defined(__GNUC__)
+#define TRANSFORM_KERNEL_AVX
+#endif
+#elif defined(__ARM_NEON)
+#define TRANSFORM_KERNEL_NEON
+#include <arm_neon.h>
+#endif
+
+namespace Arclight {
+
+using Chunk = TransformStorage2D::Chunk;
+
+// Each kernel rebuilds [begin, begin + count), count is a multiple of 8
+//     a = cos * sx, b = sin * sx, c = -sin * sy, d = cos * sy, tx = x, ty = y
+
+#if !defined(TRANSFORM_KERNEL_SSE) && !defined(TRANSFORM_KERNEL_NEON)
+static void rebuild_range_scalar(Chunk& ch, uint32_t begin, uint32_t count) {
+    for (uint32_t i = begin; i < begin + count; i++) {
+        ch.a[i] = ch.cos[i] * ch.scaleX[i];
+        ch.b[i] = ch.sin[i] * ch.scaleX[i];
+        ch.c[i] = -ch.sin[i] * ch.scaleY[i];
+        ch.d[i] = ch.cos[i] * ch.scaleY[i];
+        ch.tx[i] = ch.positionX[i];
+        ch.ty[i] = ch.positionY[i];
+    }
+}
+#endif
+
+#if defined(TRANSFORM_KERNEL_SSE)
+static void rebuild_range_sse(Chunk& ch, uint32_t begin, uint32_t count) {
+    const __m128 signMask = _mm_set1_ps(-0.f);
+    for (uint32_t i = begin; i < begin + count; i += 4) {
+        __m128 sin = _mm_load_ps(ch.sin + i);
+        __m128 cos = _mm_load_ps(ch.cos + i);
+        __m128 sx = _mm_load_ps(ch.scaleX + i);
+        __m128 sy = _mm_load_ps(ch.scaleY + i);
+
+        _mm_store_ps(ch.a + i, _mm_mul_ps(cos, sx));
+        _mm_store_ps(ch.b + i, _mm_mul_ps(sin, sx));
+        _mm_store_ps(ch.c + i, _mm_xor_ps(_mm_mul_ps(sin, sy), signMask));
+        _mm_store_ps(ch.d + i, _mm_mul_ps(cos, sy));
+        _mm_store_ps(ch.tx + i, _mm_load_ps(ch.positionX + i));
+        _mm_store_ps(ch.ty + i, _mm_load_ps(ch.positionY + i));
+    }
+}
+#endif
+
+#if defined(TRANSFORM_KERNEL_AVX)
+__attribute__((target("avx"))) static void rebuild_range_avx(Chunk& ch, uint32_t begin,
+                                                             uint32_t count) {
+    const __m256 signMask = _mm256_set1_ps(-0.f);
+    for (uint32_t i = begin; i < begin + count; i += 8) {
+        __m256 sin = _mm256_load_ps(ch.sin + i);
+        __m256 cos = _mm256_load_ps(ch.cos + i);
+        __m256 sx = _mm256_load_ps(ch.scaleX + i);
+        __m256 sy = _mm256_load_ps(ch.scaleY + i);
+
+        _mm256_store_ps(ch.a + i, _mm256_mul_ps(cos, sx));
+        _mm256_store_ps(ch.b + i, _mm256_mul_ps(sin, sx));
+        _mm256_store_ps(ch.c + i, _mm256_xor_ps(_mm256_mul_ps(sin, sy), signMask));
+        _mm256_store_ps(ch.d + i, _mm256_mul_ps(cos, sy));
+        _mm256_store_ps(ch.tx + i, _mm256_load_ps(ch.positionX + i));
+        _mm256_store_ps(ch.ty + i, _mm256_load_ps(ch.positionY + i));
+    }
+}
+#endif
+
+#if defined(TRANSFORM_KERNEL_NEON)
+static void rebuild_range_neon(Chunk& ch, uint32_t begin, uint32_t count) {
+    for (uint32_t i = begin; i < begin + count; i += 4) {
+        float32x4_t sin = vld1q_f32(ch.sin + i);
+        float32x4_t cos = vld1q_f32(ch.cos + i);
+        float32x4_t sx = vld1q_f32(ch.scaleX + i);
+        float32x4_t sy = vld1q_f32(ch.scaleY + i);
+
+        vst1q_f32(ch.a + i, vmulq_f32(cos, sx));
+        vst1q_f32(ch.b + i, vmulq_f32(sin, sx));
+        vst1q_f32(ch.c + i, vnegq_f32(vmulq_f32(sin, sy)));
+        vst1q_f32(ch.d + i, vmulq_f32(cos, sy));
+        vst1q_f32(ch.tx + i, vld1q_f32(ch.positionX + i));
+        vst1q_f32(ch.ty + i, vld1q_f32(ch.positionY + i));
+    }
+}
+#endif
+
+using RebuildKernel = void (*)(Chunk&, uint32_t, uint32_t);
+
+static RebuildKernel select_kernel() {
+#if defined(TRANSFORM_KERNEL_AVX)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx")) {
+        return rebuild_range_avx;
+    }
+#endif
+
+#if defined(TRANSFORM_KERNEL_SSE)
+    return rebuild_range_sse;
+#elif defined(TRANSFORM_KERNEL_NEON)
+    return rebuild_range_neon;
+#else
+    return rebuild_range_scalar;
+#endif
+}
+
+TransformStorage2D::~TransformStorage2D() {
+    for (auto& chunk : m_chunks) {
+        delete chunk.load(std::memory_order_relaxed);
+    }
+}
+
+TransformStorage2D& TransformStorage2D::instance() {
+    static TransformStorage2D storage;
+    return storage;
+}
+
+uint32_t TransformStorage2D::allocate() {
+    std::scoped_lock lock(m_allocationLock);
+
+    if (!m_freeSlots.empty()) {
+        uint32_t slot = m_freeSlots.back();
+        m_freeSlots.pop_back();
+        return slot;
+    }
+
+    uint32_t slot = m_nextSlot;
+    uint32_t chunkIndex = slot / ChunkSize;
+    if (chunkIndex >= MaxChunks) {
+        FatalRuntimeError("[TransformStorage2D] Exceeded maximum of {} transforms!",
+                          MaxChunks * ChunkSize);
+    }
+
+    if (!m_chunks[chunkIndex].load(std::memory_order_relaxed)) {
+        m_chunks[chunkIndex].store(new Chunk, std::memory_order_release);
+        m_chunkCount.store(chunkIndex + 1, std::memory_order_release);
+    }
+
+    m_nextSlot++;
+    return slot;
+}
+
+void TransformStorage2D::release(uint32_t slot) {
+    std::scoped_lock lock(m_allocationLock);
+
+    m_freeSlots.push_back(slot);
+}
+
+void TransformStorage2D::rebuild_dirty() {
+    uint32_t count = chunk_count();
+
+    parallel_for(count, 1, [this](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            Chunk& c = *m_chunks[i].load(std::memory_order_acquire);
+            if (c.anyDirty.exchange(false, std::memory_order_relaxed)) {
+                rebuild_chunk(c);
+            }
+        }
+    });
+}
+
+void TransformStorage2D::rebuild_chunk(Chunk& chunk) {
+    static const RebuildKernel kernel = select_kernel();
+
+    // Rebuilding all 64 transforms of a dirty word is cheaper than
+    // picking out the dirty ones, and free or clean slots are harmless
+    for (uint32_t w = 0; w < ChunkSize / 64; w++) {
+        if (chunk.dirty[w].load(std::memory_order_relaxed) &&
+            chunk.dirty[w].exchange(0, std::memory_order_relaxed)) {
+            kernel(chunk, w * 64, 64);
+        }
+    }
+}
+
+PackedTransform2D::PackedTransform2D(const Vector2f& position, const Vector2f& scale,
+                                     float rotationDegrees)
+    : m_slot(TransformStorage2D::instance().allocate()) {
+    TransformStorage2D& storage = TransformStorage2D::instance();
+    TransformStorage2D::Chunk& c = storage.chunk(m_slot);
+    uint32_t i = TransformStorage2D::chunk_index(m_slot);
+
+    c.positionX[i] = position.x;
+    c.positionY[i] = position.y;
+    c.zIndex[i] = 0;
+    c.scaleX[i] = scale.x;
+    c.scaleY[i] = scale.y;
+
+    set_rotation(rotationDegrees); // Marks dirty
+}
+
+PackedTransform2D::PackedTransform2D(const PackedTransform2D& other)
+    : m_slot(TransformStorage2D::instance().allocate()) {
+    copy_from(other);
+}
+
+PackedTransform2D::PackedTransform2D(PackedTransform2D&& other) noexcept
+    : m_slot(std::exchange(other.m_slot, TransformStorage2D::InvalidSlot)) {}
+
+PackedTransform2D::~PackedTransform2D() {
+    if (m_slot != TransformStorage2D::InvalidSlot) {
+        TransformStorage2D::instance().release(m_slot);
+    }
+}
+
+PackedTransform2D& PackedTransform2D::operator=(const PackedTransform2D& other) {
+    if (this != &other) {
+        if (m_slot == TransformStorage2D::InvalidSlot) {
+            m_slot = TransformStorage2D::instance().allocate();
+        }
+
+        copy_from(other);
+    }
+
+    return *this;
+}
+
+PackedTransform2D& PackedTransform2D::operator=(PackedTransform2D&& other) noexcept {
+    if (this != &other) {
+        std::swap(m_slot, other.m_slot);
+    }
+
+    return *this;
+}
+
+void PackedTransform2D::copy_from(const PackedTransform2D& other) {
+    TransformStorage2D& storage = TransformStorage2D::instance();
+    TransformStorage2D::Chunk& c = storage.chunk(m_slot);
+    const TransformStorage2D::Chunk& o = storage.chunk(other.m_slot);
+    uint32_t i = TransformStorage2D::chunk_index(m_slot);
+    uint32_t j = TransformStorage2D::chunk_index(other.m_slot);
+
+    c.positionX[i] = o.positionX[j];
+    c.positionY[i] = o.positionY[j];
+    c.zIndex[i] = o.zIndex[j];
+    c.scaleX[i] = o.scaleX[j];
+    c.scaleY[i] = o.scaleY[j];
+    c.rotation[i] = o.rotation[j];
+    c.sin[i] = o.sin[j];
+    c.cos[i] = o.cos[j];
+
+    storage.mark_dirty(m_slot);
+}
+
+PackedTransform2D& PackedTransform2D::set_position(const Vector2f& position) {
+    TransformStorage2D& storage = TransformStorage2D::instance();
+    TransformStorage2D::Chunk& c = storage.chunk(m_slot);
+    uint32_t i = TransformStorage2D::chunk_index(m_slot);
+
+    c.positionX[i] = position.x;
+    c.positionY[i] = position.y;
+
+    storage.mark_dirty(m_slot);
+    return *this;
+}
+
+PackedTransform2D& PackedTransform2D::set_z_index(float z) {
+    // z is not part of the affine matrix, nothing to rebuild
+    TransformStorage2D& storage = TransformStorage2D::instance();
+    storage.chunk(m_slot).zIndex[TransformStorage2D::chunk_index(m_slot)] = z;
+
+    return *this;
+}
+
+PackedTransform2D& PackedTransform2D::set_scale(const Vector2f& scale) {
+    TransformStorage2D& storage = TransformStorage2D::instance();
+    TransformStorage2D::Chunk& c = storage.chunk(m_slot);
+    uint32_t i = TransformStorage2D::chunk_index(m_slot);
+
+    c.scaleX[i] = scale.x;
+    c.scaleY[i] = scale.y;
+
+    storage.mark_dirty(m_slot);
+    return *this;
+}
+
+PackedTransform2D& PackedTransform2D::set_rotation(float degrees) {
+    TransformStorage2D& storage = TransformStorage2D::instance();
+    TransformStorage2D::Chunk& c = storage.chunk(m_slot);
+    uint32_t i = TransformStorage2D::chunk_index(m_slot);
+
+    float radians = degrees * (M_PI / 180.f);
+    c.rotation[i] = radians;
+    c.sin[i] = sinf(radians);
+    c.cos[i] = cosf(radians);
+
+    storage.mark_dirty(m_slot);
+    return *this;
+}
+
+PackedTransform2D& PackedTransform2D::translate(const Vector2f& delta) {
+    TransformStorage2D& storage = TransformStorage2D::instance();
+    TransformStorage2D::Chunk& c = storage.chunk(m_slot);
+    uint32_t i = TransformStorage2D::chunk_index(m_slot);
+
+    c.positionX[i] += delta.x;
+    c.positionY[i] += delta.y;
+
+    storage.mark_dirty(m_slot);
+    return *this;
+}
+
+Vector2f PackedTransform2D::get_position() const {
+    const TransformStorage2D::Chunk& c = TransformStorage2D::instance().chunk(m_slot);
+    uint32_t i = TransformStorage2D::chunk_index(m_slot);
+
+    return {c.positionX[i], c.positionY[i]};
+}
+
+float PackedTransform2D::get_z_index() const {
+    const TransformStorage2D& storage = TransformStorage2D::instance();
+    return storage.chunk(m_slot).zIndex[TransformStorage2D::chunk_index(m_slot)];
+}
+
+Vector2f PackedTransform2D::get_scale() const {
+    const TransformStorage2D::Chunk& c = TransformStorage2D::instance().chunk(m_slot);
+    uint32_t i = TransformStorage2D::chunk_index(m_slot);
+
+    return {c.scaleX[i], c.scaleY[i]};
+}
+
+float PackedTransform2D::get_rotation() const {
+    const TransformStorage2D& storage = TransformStorage2D::instance();
+    return storage.chunk(m_slot).rotation[TransformStorage2D::chunk_index(m_slot)] * (180.f / M_PI);
+}
+
+} // namespace Arclight
@@ -22,6 +22,8 @@ const RenderPipeline::PipelineFixedConfig RenderPipeline::defaultConfig = {
         .enabled = false,
     },
     .topology = PrimitiveTriangleStrip,
+    .vertexLayout = VertexLayoutDefault,
+    .bindlessTextures = false,
 };
 
 } // namespace Arclight::Rendering
\ No newline at end of file
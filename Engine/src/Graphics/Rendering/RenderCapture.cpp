@@ -0,0 +1,1042 @@
+#include <Arclight/Graphics/Rendering/RenderCapture.h>
+
+#include <Arclight/Core/File.h>
+#include <Arclight/Core/Logger.h>
+#include <Arclight/Window/WindowContext.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+
+namespace Arclight::Rendering {
+
+namespace {
+
+// File layout:
+//     "ARCC", u32 version, u32 name length, captured renderer name
+//     Commands, each a u8 Command followed by its arguments
+// IDs are u32, 0 is a null handle.
+// Vertex buffer IDs of draws with transientID set are the index of a transient allocation
+// of the frame instead, their first vertex is relative to the allocation.
+enum Command : uint8_t {
+    CommandRender = 1,            // End of a frame
+    CommandResizeViewport,        // i32 width, i32 height
+    CommandSetDrawCallSorting,    // u8 enabled
+    CommandCreatePipeline,        // ID, PipelineFixedConfig as u8s,
+                                  // u32 size and vertex shader, u32 size and fragment shader
+    CommandDestroyPipeline,       // ID
+    CommandAllocateTexture,       // ID, u32 width, u32 height, u8 format
+    CommandUpdateTexture,         // ID, u32 size, pixels
+    CommandDestroyTexture,        // ID
+    CommandAllocateVertexBuffer,  // ID, u32 vertex count
+    CommandUpdateVertexBuffer,    // ID, u32 offset, u32 count, vertices
+    CommandDestroyVertexBuffer,   // ID
+    CommandBindPipeline,          // ID
+    CommandBindTexture,           // ID
+    CommandBindVertexBuffer,      // ID
+    CommandSetView,               // Matrix4, used by every following draw
+    CommandDraw,                  // Vertex buffer ID, u32 first vertex, u32 vertex count,
+                                  // Affine2D, f32 z, texture ID, pipeline ID, u8 layer
+    CommandDrawQuads,             // Same as CommandDraw with the quad count as the count
+    CommandDrawInstanced,         // u32 count, instances, texture ID, pipeline ID, u8 layer
+    CommandAllocateTransient,     // u32 size, indexed from 0 in every frame
+    CommandUpdateTransient,       // u32 index, u32 size, data, written before CommandRender
+};
+
+const uint32_t transientID = 0x80000000;
+
+// Default pipelines have fixed IDs so they map to the defaults of any backend
+enum PipelineID : uint32_t {
+    PipelineDefault = 1,
+    PipelineDefaultBatch,
+    PipelineDefaultInstanced,
+    PipelineDefaultSDF,
+    PipelineDefaultSDFInstanced,
+    PipelineFirstCustom,
+};
+
+const char captureMagic[4] = {'A', 'R', 'C', 'C'};
+
+inline bool same_matrix(const Matrix4& a, const Matrix4& b) {
+    return !std::memcmp(a.matrix(), b.matrix(), sizeof(float) * 16);
+}
+
+template <typename T> inline T lookup(const std::vector<T>& table, uint32_t id) {
+    return id < table.size() ? table[id] : T{};
+}
+
+template <typename T> inline T& slot(std::vector<T>& table, uint32_t id) {
+    if (id >= table.size()) {
+        table.resize(id + 1);
+    }
+
+    return table[id];
+}
+
+} // namespace
+
+CaptureRenderer::CaptureRenderer(Renderer& renderer, const std::string& path)
+    : m_renderer(renderer), m_path(path), m_nextPipelineID(PipelineFirstCustom) {}
+
+CaptureRenderer::~CaptureRenderer() {
+    std::scoped_lock lock(m_lock);
+    flush();
+
+    delete m_file;
+}
+
+int CaptureRenderer::initialize(WindowContext* context) {
+    m_file = File::Open(m_path.c_str(), File::OpenWrite);
+    if (!m_file) {
+        Logger::Error("CaptureRenderer: Failed to open '{}'!", m_path);
+        return -1;
+    }
+
+    // Insert the batch pipeline first, backends may use the same pipeline for both
+    m_pipelines.emplace(m_renderer.default_batch_pipeline().handle(), PipelineDefaultBatch);
+    m_pipelines.emplace(m_renderer.default_pipeline().handle(), PipelineDefault);
+    m_pipelines.emplace(m_renderer.default_instanced_pipeline().handle(),
+                        PipelineDefaultInstanced);
+    m_pipelines.emplace(m_renderer.default_sdf_pipeline().handle(), PipelineDefaultSDF);
+    m_pipelines.emplace(m_renderer.default_sdf_instanced_pipeline().handle(),
+                        PipelineDefaultSDFInstanced);
+
+    std::scoped_lock lock(m_lock);
+    write_bytes(captureMagic, sizeof(captureMagic));
+    write<uint32_t>(RENDERCAPTURE_VERSION);
+
+    const std::string& name = m_renderer.get_name();
+    write<uint32_t>(name.size());
+    write_bytes(name.data(), name.size());
+
+    // Replays without a window start at the size of the captured one
+    if (context) {
+        write(CommandResizeViewport);
+        write<int32_t>(context->get_size().x);
+        write<int32_t>(context->get_size().y);
+    }
+
+    Logger::Debug("CaptureRenderer: Capturing {} to '{}'", name, m_path);
+
+    s_rendererInstance = this;
+    return 0;
+}
+
+void CaptureRenderer::render() {
+    {
+        std::scoped_lock lock(m_lock);
+        write_mapped_vertex_buffers();
+        write_transients();
+
+        if (m_sortDrawCalls != m_recordedSorting) {
+            write(CommandSetDrawCallSorting);
+            write<uint8_t>(m_sortDrawCalls);
+            m_recordedSorting = m_sortDrawCalls;
+        }
+
+        write(CommandRender);
+        if (m_buffer.size() >= RENDERCAPTURE_FLUSH_SIZE) {
+            flush();
+        }
+    }
+
+    // Draws may not be submitted during render() so they can not slip in before it
+    m_renderer.set_draw_call_sorting(m_sortDrawCalls);
+    m_renderer.render();
+}
+
+void CaptureRenderer::resize_viewport(const Vector2i& newPixelSize) {
+    std::scoped_lock lock(m_lock);
+    write(CommandResizeViewport);
+    write<int32_t>(newPixelSize.x);
+    write<int32_t>(newPixelSize.y);
+
+    m_renderer.resize_viewport(newPixelSize);
+}
+
+void CaptureRenderer::bind_texture(Texture::TextureHandle texture) {
+    std::scoped_lock lock(m_lock);
+    write(CommandBindTexture);
+    write(texture_id(texture));
+
+    m_renderer.bind_texture(texture);
+}
+
+void CaptureRenderer::bind_vertex_buffer(void* buffer) {
+    std::scoped_lock lock(m_lock);
+    write(CommandBindVertexBuffer);
+    write(vertex_buffer_id(buffer));
+
+    m_renderer.bind_vertex_buffer(buffer);
+}
+
+void CaptureRenderer::bind_pipeline(RenderPipeline::PipelineHandle pipeline) {
+    std::scoped_lock lock(m_lock);
+    write(CommandBindPipeline);
+    write(pipeline_id(pipeline));
+
+    m_renderer.bind_pipeline(pipeline);
+}
+
+void CaptureRenderer::draw(void* vertexBuffer, unsigned firstVertex, unsigned vertexCount,
+                           const Matrix4& transform, const Matrix4& view,
+                           Texture::TextureHandle texture,
+                           RenderPipeline::PipelineHandle renderPipeline, uint8_t layer) {
+    if (!renderPipeline) {
+        renderPipeline = m_renderer.default_pipeline().handle();
+    }
+
+    std::scoped_lock lock(m_lock);
+    write_draw(CommandDraw, vertexBuffer, firstVertex, vertexCount, transform, view, texture,
+               renderPipeline, layer);
+
+    m_renderer.draw(vertexBuffer, firstVertex, vertexCount, transform, view, texture,
+                    renderPipeline, layer);
+}
+
+void CaptureRenderer::draw_quads(void* vertexBuffer, unsigned firstVertex, unsigned quadCount,
+                                 const Matrix4& transform, const Matrix4& view,
+                                 Texture::TextureHandle texture,
+                                 RenderPipeline::PipelineHandle renderPipeline, uint8_t layer) {
+    if (!renderPipeline) {
+        renderPipeline = m_renderer.default_batch_pipeline().handle();
+    }
+
+    std::scoped_lock lock(m_lock);
+    write_draw(CommandDrawQuads, vertexBuffer, firstVertex, quadCount, transform, view, texture,
+               renderPipeline, layer);
+
+    m_renderer.draw_quads(vertexBuffer, firstVertex, quadCount, transform, view, texture,
+                          renderPipeline, layer);
+}
+
+void CaptureRenderer::draw_instanced(const SpriteInstance* instances, unsigned instanceCount,
+                                     const Matrix4& view, Texture::TextureHandle texture,
+                                     RenderPipeline::PipelineHandle renderPipeline,
+                                     uint8_t layer) {
+    if (!instanceCount) {
+        return;
+    }
+
+    if (!renderPipeline) {
+        renderPipeline = m_renderer.default_instanced_pipeline().handle();
+    }
+
+    std::scoped_lock lock(m_lock);
+    write_view(view);
+    write(CommandDrawInstanced);
+    write<uint32_t>(instanceCount);
+    write_bytes(instances, sizeof(SpriteInstance) * instanceCount);
+    write(texture_id(texture));
+    write(pipeline_id(renderPipeline));
+    write(layer);
+
+    m_renderer.draw_instanced(instances, instanceCount, view, texture, renderPipeline, layer);
+}
+
+RenderPipeline::PipelineHandle
+CaptureRenderer::create_pipeline(const Shader& vertexShader, const Shader& fragmentShader,
+                                 const RenderPipeline::PipelineFixedConfig& config) {
+    std::scoped_lock lock(m_lock);
+
+    RenderPipeline::PipelineHandle handle =
+        m_renderer.create_pipeline(vertexShader, fragmentShader, config);
+    if (!handle) {
+        return nullptr;
+    }
+
+    const uint32_t id = m_nextPipelineID++;
+    m_pipelines[handle] = id;
+
+    write(CommandCreatePipeline);
+    write(id);
+    write<uint8_t>(config.rasterizer.polygonMode);
+    write<uint8_t>(config.blending.colourBlendOp);
+    write<uint8_t>(config.blending.alphaBlendOp);
+    write<uint8_t>(config.blending.enabled);
+    write<uint8_t>(config.topology);
+    write<uint8_t>(config.vertexLayout);
+
+    for (const Shader* shader : {&vertexShader, &fragmentShader}) {
+        write<uint32_t>(shader->DataSize());
+        write_bytes(shader->GetData(), shader->DataSize());
+    }
+
+    return handle;
+}
+
+void CaptureRenderer::destroy_pipeline(RenderPipeline::PipelineHandle handle) {
+    std::scoped_lock lock(m_lock);
+
+    auto it = m_pipelines.find(handle);
+    if (it != m_pipelines.end()) {
+        write(CommandDestroyPipeline);
+        write(it->second);
+        m_pipelines.erase(it);
+    }
+
+    m_renderer.destroy_pipeline(handle);
+}
+
+Texture::TextureHandle CaptureRenderer::allocate_texture(const Vector2u& bounds,
+                                                         Texture::Format texFormat) {
+    std::scoped_lock lock(m_lock);
+
+    Texture::TextureHandle handle = m_renderer.allocate_texture(bounds, texFormat);
+    if (!handle) {
+        return nullptr;
+    }
+
+    const uint32_t id = m_nextTextureID++;
+    m_textures[handle] = TextureInfo{id, bounds, texFormat};
+
+    write(CommandAllocateTexture);
+    write(id);
+    write<uint32_t>(bounds.x);
+    write<uint32_t>(bounds.y);
+    write<uint8_t>(texFormat);
+
+    return handle;
+}
+
+void CaptureRenderer::update_texture(Texture::TextureHandle texture, const void* data) {
+    std::scoped_lock lock(m_lock);
+
+    auto it = m_textures.find(texture);
+    if (it != m_textures.end()) {
+        const TextureInfo& info = it->second;
+        const size_t size =
+            static_cast<size_t>(info.size.x) * info.size.y * Texture::formatSizes[info.format];
+
+        write(CommandUpdateTexture);
+        write(info.id);
+        write<uint32_t>(size);
+        write_bytes(data, size);
+    }
+
+    m_renderer.update_texture(texture, data);
+}
+
+void CaptureRenderer::destroy_texture(Texture::TextureHandle texture) {
+    std::scoped_lock lock(m_lock);
+
+    auto it = m_textures.find(texture);
+    if (it != m_textures.end()) {
+        write(CommandDestroyTexture);
+        write(it->second.id);
+        m_textures.erase(it);
+    }
+
+    m_renderer.destroy_texture(texture);
+}
+
+void* CaptureRenderer::allocate_vertex_buffer(unsigned vertexCount) {
+    std::scoped_lock lock(m_lock);
+
+    void* handle = m_renderer.allocate_vertex_buffer(vertexCount);
+    if (!handle) {
+        return nullptr;
+    }
+
+    const uint32_t id = m_nextVertexBufferID++;
+    m_vertexBuffers[handle] = VertexBufferInfo{id, vertexCount, {}, nullptr};
+
+    write(CommandAllocateVertexBuffer);
+    write(id);
+    write<uint32_t>(vertexCount);
+
+    return handle;
+}
+
+void CaptureRenderer::update_vertex_buffer(void* buffer, unsigned int offset, unsigned int size,
+                                           const Vertex* vertices) {
+    std::scoped_lock lock(m_lock);
+
+    auto it = m_vertexBuffers.find(buffer);
+    if (it != m_vertexBuffers.end()) {
+        VertexBufferInfo& info = it->second;
+
+        write(CommandUpdateVertexBuffer);
+        write(info.id);
+        write<uint32_t>(offset);
+        write<uint32_t>(size);
+        write_bytes(vertices, sizeof(Vertex) * size);
+
+        // Keep mapped buffers from being recorded twice
+        if (info.mapping && offset + size <= info.shadow.size()) {
+            std::memcpy(info.shadow.data() + offset, vertices, sizeof(Vertex) * size);
+        }
+    }
+
+    m_renderer.update_vertex_buffer(buffer, offset, size, vertices);
+}
+
+void* CaptureRenderer::get_vertex_buffer_mapping(void* buffer) {
+    std::scoped_lock lock(m_lock);
+
+    void* mapping = m_renderer.get_vertex_buffer_mapping(buffer);
+
+    auto it = m_vertexBuffers.find(buffer);
+    if (it != m_vertexBuffers.end() && mapping && !it->second.mapping) {
+        VertexBufferInfo& info = it->second;
+
+        // The buffer holds what was recorded so far, changes are picked up by render()
+        info.mapping = static_cast<Vertex*>(mapping);
+        info.shadow.assign(info.mapping, info.mapping + info.vertexCount);
+    }
+
+    return mapping;
+}
+
+void CaptureRenderer::destroy_vertex_buffer(void* buffer) {
+    std::scoped_lock lock(m_lock);
+
+    auto it = m_vertexBuffers.find(buffer);
+    if (it != m_vertexBuffers.end()) {
+        write(CommandDestroyVertexBuffer);
+        write(it->second.id);
+        m_vertexBuffers.erase(it);
+    }
+
+    m_renderer.destroy_vertex_buffer(buffer);
+}
+
+Renderer::TransientAllocation CaptureRenderer::allocate_transient(size_t size) {
+    std::scoped_lock lock(m_lock);
+
+    TransientAllocation allocation = m_renderer.allocate_transient(size);
+    if (!allocation.data) {
+        return allocation;
+    }
+
+    // Contents are only known once they have been written, render() records them
+    m_transients.emplace_back(allocation, size);
+
+    write(CommandAllocateTransient);
+    write<uint32_t>(size);
+
+    return allocation;
+}
+
+template <typename T> void CaptureRenderer::write(const T& value) {
+    write_bytes(&value, sizeof(T));
+}
+
+void CaptureRenderer::write_bytes(const void* data, size_t size) {
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    m_buffer.insert(m_buffer.end(), bytes, bytes + size);
+}
+
+void CaptureRenderer::write_view(const Matrix4& view) {
+    if (m_hasView && same_matrix(view, m_view)) {
+        return;
+    }
+
+    write(CommandSetView);
+    write_bytes(view.matrix(), sizeof(float) * 16);
+
+    m_view = view;
+    m_hasView = true;
+}
+
+void CaptureRenderer::write_draw(uint8_t command, void* vertexBuffer, unsigned first,
+                                 unsigned count, const Matrix4& transform, const Matrix4& view,
+                                 Texture::TextureHandle texture,
+                                 RenderPipeline::PipelineHandle pipeline, uint8_t layer) {
+    write_view(view);
+
+    uint32_t bufferID = vertex_buffer_id(vertexBuffer);
+    if (!bufferID) {
+        // Allocations do not overlap, find the one holding the first vertex
+        for (size_t i = 0; i < m_transients.size(); i++) {
+            const auto& [allocation, size] = m_transients[i];
+            const size_t offset = static_cast<size_t>(first) * sizeof(Vertex);
+            if (allocation.vertexBuffer == vertexBuffer && offset >= allocation.offset &&
+                offset < allocation.offset + size) {
+                bufferID = transientID | static_cast<uint32_t>(i);
+                first -= allocation.first_vertex();
+                break;
+            }
+        }
+    }
+
+    // The backend only keeps the 2D part and z of the transform
+    write(command);
+    write(bufferID);
+    write<uint32_t>(first);
+    write<uint32_t>(count);
+    write(Affine2D::from_matrix4(transform));
+    write(transform.matrix()[14]);
+    write(texture_id(texture));
+    // The batch pipeline may be the default pipeline, draw_quads always means the batch one
+    write(command == CommandDrawQuads && pipeline == m_renderer.default_batch_pipeline().handle()
+              ? static_cast<uint32_t>(PipelineDefaultBatch)
+              : pipeline_id(pipeline));
+    write(layer);
+}
+
+void CaptureRenderer::write_mapped_vertex_buffers() {
+    for (auto& [handle, info] : m_vertexBuffers) {
+        if (!info.mapping ||
+            !std::memcmp(info.mapping, info.shadow.data(), sizeof(Vertex) * info.vertexCount)) {
+            continue;
+        }
+
+        // Only record the changed range
+        unsigned first = 0;
+        while (!std::memcmp(&info.mapping[first], &info.shadow[first], sizeof(Vertex))) {
+            first++;
+        }
+
+        unsigned end = info.vertexCount;
+        while (!std::memcmp(&info.mapping[end - 1], &info.shadow[end - 1], sizeof(Vertex))) {
+            end--;
+        }
+
+        write(CommandUpdateVertexBuffer);
+        write(info.id);
+        write<uint32_t>(first);
+        write<uint32_t>(end - first);
+        write_bytes(info.mapping + first, sizeof(Vertex) * (end - first));
+
+        std::memcpy(info.shadow.data() + first, info.mapping + first,
+                    sizeof(Vertex) * (end - first));
+    }
+}
+
+void CaptureRenderer::write_transients() {
+    for (size_t i = 0; i < m_transients.size(); i++) {
+        const auto& [allocation, size] = m_transients[i];
+
+        write(CommandUpdateTransient);
+        write<uint32_t>(i);
+        write<uint32_t>(size);
+        write_bytes(allocation.data, size);
+    }
+
+    m_transients.clear();
+}
+
+void CaptureRenderer::flush() {
+    if (m_file && !m_buffer.empty()) {
+        if (m_file->Write(m_buffer.data(), m_buffer.size()) < 0) {
+            Logger::Error("CaptureRenderer: Failed to write '{}'!", m_path);
+        }
+    }
+
+    m_buffer.clear();
+}
+
+uint32_t CaptureRenderer::pipeline_id(RenderPipeline::PipelineHandle pipeline) {
+    auto it = m_pipelines.find(pipeline);
+    return it != m_pipelines.end() ? it->second : 0;
+}
+
+uint32_t CaptureRenderer::texture_id(Texture::TextureHandle texture) const {
+    auto it = m_textures.find(texture);
+    return it != m_textures.end() ? it->second.id : 0;
+}
+
+uint32_t CaptureRenderer::vertex_buffer_id(void* buffer) const {
+    auto it = m_vertexBuffers.find(buffer);
+    return it != m_vertexBuffers.end() ? it->second.id : 0;
+}
+
+class CaptureReplay::Reader final {
+public:
+    Reader(const std::vector<uint8_t>& data, size_t offset)
+        : m_position(data.data() + offset), m_end(data.data() + data.size()) {}
+
+    template <typename T> inline bool read(T& value) {
+        const uint8_t* bytes = read_bytes(sizeof(T));
+        if (!bytes) {
+            return false;
+        }
+
+        std::memcpy(&value, bytes, sizeof(T));
+        return true;
+    }
+
+    // nullptr if there are not enough bytes left
+    inline const uint8_t* read_bytes(size_t size) {
+        if (static_cast<size_t>(m_end - m_position) < size) {
+            return nullptr;
+        }
+
+        const uint8_t* bytes = m_position;
+        m_position += size;
+        return bytes;
+    }
+
+    inline bool at_end() const { return m_position == m_end; }
+    inline const uint8_t* position() const { return m_position; }
+
+private:
+    const uint8_t* m_position;
+    const uint8_t* m_end;
+};
+
+CaptureReplay::CaptureReplay(Renderer& renderer) : m_renderer(renderer) {}
+
+CaptureReplay::~CaptureReplay() { reset(); }
+
+bool CaptureReplay::load(const std::string& path) {
+    reset();
+    m_data.clear();
+    m_frames.clear();
+
+    File* file = File::Open(path.c_str());
+    if (!file) {
+        Logger::Error("CaptureReplay: Failed to open '{}'!", path);
+        return false;
+    }
+
+    m_data.resize(file->get_size());
+    bool failed = file->Read(m_data.data(), m_data.size()) < 0;
+    delete file;
+
+    if (failed) {
+        Logger::Error("CaptureReplay: Failed to read '{}'!", path);
+        return false;
+    }
+
+    Reader reader(m_data, 0);
+    const uint8_t* magic = reader.read_bytes(sizeof(captureMagic));
+    uint32_t version = 0;
+    uint32_t nameLength = 0;
+    if (!magic || std::memcmp(magic, captureMagic, sizeof(captureMagic)) ||
+        !reader.read(version) || !reader.read(nameLength)) {
+        Logger::Error("CaptureReplay: '{}' is not a capture!", path);
+        return false;
+    }
+
+    if (version != RENDERCAPTURE_VERSION) {
+        Logger::Error("CaptureReplay: '{}' is capture version {}, expected {}!", path, version,
+                      RENDERCAPTURE_VERSION);
+        return false;
+    }
+
+    const uint8_t* name = reader.read_bytes(nameLength);
+    if (!name) {
+        Logger::Error("CaptureReplay: '{}' is truncated!", path);
+        return false;
+    }
+    m_capturedRenderer.assign(reinterpret_cast<const char*>(name), nameLength);
+
+    // Validate every command and find where frames start, a capture cut off
+    // by a crash still replays up to its last whole frame
+    size_t frameStart = reader.position() - m_data.data();
+    while (!reader.at_end()) {
+        uint8_t command = 0;
+        reader.read(command);
+        if (!run_command(reader, command, false)) {
+            Logger::Warning("CaptureReplay: '{}' is corrupt after {} frames", path,
+                            m_frames.size());
+            break;
+        }
+
+        if (command == CommandRender) {
+            m_frames.push_back(frameStart);
+            frameStart = reader.position() - m_data.data();
+        }
+    }
+
+    // The validation pass filled in resource sizes
+    m_textureSizes.clear();
+    m_vertexBufferSizes.clear();
+    m_transientSizes.clear();
+    return true;
+}
+
+bool CaptureReplay::replay_frame(unsigned frame) {
+    assert(frame < m_frames.size());
+
+    Reader reader(m_data, m_frames[frame]);
+    uint8_t command = 0;
+    while (reader.read(command)) {
+        if (!run_command(reader, command, true)) {
+            return false;
+        }
+
+        if (command == CommandRender) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void CaptureReplay::reset() {
+    m_renderer.wait_device_idle();
+
+    for (Texture::TextureHandle texture : m_textures) {
+        if (texture) {
+            m_renderer.destroy_texture(texture);
+        }
+    }
+
+    for (void* buffer : m_vertexBuffers) {
+        if (buffer) {
+            m_renderer.destroy_vertex_buffer(buffer);
+        }
+    }
+
+    for (RenderPipeline::PipelineHandle pipeline : m_createdPipelines) {
+        m_renderer.destroy_pipeline(pipeline);
+    }
+
+    m_pipelines.clear();
+    m_textures.clear();
+    m_vertexBuffers.clear();
+    m_textureSizes.clear();
+    m_vertexBufferSizes.clear();
+    m_transients.clear();
+    m_transientSizes.clear();
+    m_createdPipelines.clear();
+    m_view = Matrix4();
+}
+
+bool CaptureReplay::run_command(Reader& reader, uint8_t command, bool issue) {
+    uint32_t id = 0;
+
+    switch (command) {
+    case CommandRender:
+        if (issue) {
+            m_renderer.render();
+        }
+
+        // Transient allocations only last a frame
+        m_transients.clear();
+        m_transientSizes.clear();
+        return true;
+    case CommandResizeViewport: {
+        int32_t width, height;
+        if (!reader.read(width) || !reader.read(height)) {
+            return false;
+        }
+
+        if (issue) {
+            m_renderer.resize_viewport({width, height});
+        }
+        return true;
+    }
+    case CommandSetDrawCallSorting: {
+        uint8_t enabled;
+        if (!reader.read(enabled)) {
+            return false;
+        }
+
+        if (issue) {
+            m_renderer.set_draw_call_sorting(enabled);
+        }
+        return true;
+    }
+    case CommandCreatePipeline: {
+        uint8_t fields[6];
+        if (!reader.read(id) || !reader.read(fields) || id < PipelineFirstCustom) {
+            return false;
+        }
+
+        std::vector<uint8_t> shaders[2];
+        for (auto& shader : shaders) {
+            uint32_t size = 0;
+            const uint8_t* data = nullptr;
+            if (!reader.read(size) || !(data = reader.read_bytes(size))) {
+                return false;
+            }
+
+            shader.assign(data, data + size);
+        }
+
+        if (!issue) {
+            return true;
+        }
+
+        RenderPipeline::PipelineFixedConfig config;
+        config.rasterizer.polygonMode =
+            static_cast<RenderPipeline::RasterizerConfig::PolygonMode>(fields[0]);
+        config.blending.colourBlendOp =
+            static_cast<RenderPipeline::ColourBlending::BlendOp>(fields[1]);
+        config.blending.alphaBlendOp =
+            static_cast<RenderPipeline::ColourBlending::BlendOp>(fields[2]);
+        config.blending.enabled = fields[3];
+        config.topology = static_cast<RenderPipeline::PrimitiveType>(fields[4]);
+        config.vertexLayout = static_cast<RenderPipeline::VertexLayout>(fields[5]);
+
+        RenderPipeline::PipelineHandle handle = nullptr;
+        if (m_capturedRenderer == m_renderer.get_name()) {
+            handle = m_renderer.create_pipeline(Shader(Shader::VertexShader, shaders[0]),
+                                                Shader(Shader::FragmentShader, shaders[1]),
+                                                config);
+            if (handle) {
+                m_createdPipelines.push_back(handle);
+            }
+        } else {
+            // Shaders are specific to the backend
+            if (!m_warnedCustomPipeline) {
+                Logger::Warning("CaptureReplay: Capture is from {}, custom pipelines are "
+                                "replaced with default pipelines",
+                                m_capturedRenderer);
+                m_warnedCustomPipeline = true;
+            }
+
+            handle = config.vertexLayout == RenderPipeline::VertexLayoutSpriteInstance
+                         ? m_renderer.default_instanced_pipeline().handle()
+                         : m_renderer.default_pipeline().handle();
+        }
+
+        slot(m_pipelines, id) = handle;
+        return true;
+    }
+    case CommandDestroyPipeline: {
+        if (!reader.read(id)) {
+            return false;
+        }
+
+        if (issue) {
+            RenderPipeline::PipelineHandle handle = pipeline(id);
+            auto it = std::find(m_createdPipelines.begin(), m_createdPipelines.end(), handle);
+            if (handle && it != m_createdPipelines.end()) {
+                m_renderer.destroy_pipeline(handle);
+                m_createdPipelines.erase(it);
+            }
+
+            slot(m_pipelines, id) = nullptr;
+        }
+        return true;
+    }
+    case CommandAllocateTexture: {
+        uint32_t width, height;
+        uint8_t format;
+        if (!reader.read(id) || !reader.read(width) || !reader.read(height) ||
+            !reader.read(format) || format > Texture::Format_A8_SRGB) {
+            return false;
+        }
+
+        slot(m_textureSizes, id) =
+            static_cast<size_t>(width) * height * Texture::formatSizes[format];
+        if (issue) {
+            slot(m_textures, id) =
+                m_renderer.allocate_texture({width, height}, static_cast<Texture::Format>(format));
+        }
+        return true;
+    }
+    case CommandUpdateTexture: {
+        uint32_t size = 0;
+        const uint8_t* pixels = nullptr;
+        if (!reader.read(id) || !reader.read(size) || !(pixels = reader.read_bytes(size))) {
+            return false;
+        }
+
+        // The backend reads the whole texture
+        if (size < lookup(m_textureSizes, id)) {
+            return false;
+        }
+
+        if (issue) {
+            if (Texture::TextureHandle texture = lookup(m_textures, id)) {
+                m_renderer.update_texture(texture, pixels);
+            }
+        }
+        return true;
+    }
+    case CommandDestroyTexture:
+        if (!reader.read(id)) {
+            return false;
+        }
+
+        if (issue) {
+            if (Texture::TextureHandle texture = lookup(m_textures, id)) {
+                m_renderer.destroy_texture(texture);
+                slot(m_textures, id) = nullptr;
+            }
+        }
+        return true;
+    case CommandAllocateVertexBuffer: {
+        uint32_t vertexCount;
+        if (!reader.read(id) || !reader.read(vertexCount)) {
+            return false;
+        }
+
+        slot(m_vertexBufferSizes, id) = vertexCount;
+        if (issue) {
+            slot(m_vertexBuffers, id) = m_renderer.allocate_vertex_buffer(vertexCount);
+        }
+        return true;
+    }
+    case CommandUpdateVertexBuffer: {
+        uint32_t offset, count;
+        const uint8_t* vertices = nullptr;
+        if (!reader.read(id) || !reader.read(offset) || !reader.read(count) ||
+            !(vertices = reader.read_bytes(sizeof(Vertex) * count))) {
+            return false;
+        }
+
+        if (static_cast<uint64_t>(offset) + count > lookup(m_vertexBufferSizes, id)) {
+            return false;
+        }
+
+        if (issue) {
+            if (void* buffer = lookup(m_vertexBuffers, id)) {
+                // Copied out as capture data is not aligned
+                std::vector<Vertex> copy(count);
+                std::memcpy(copy.data(), vertices, sizeof(Vertex) * count);
+                m_renderer.update_vertex_buffer(buffer, offset, count, copy.data());
+            }
+        }
+        return true;
+    }
+    case CommandDestroyVertexBuffer:
+        if (!reader.read(id)) {
+            return false;
+        }
+
+        if (issue) {
+            if (void* buffer = lookup(m_vertexBuffers, id)) {
+                m_renderer.destroy_vertex_buffer(buffer);
+                slot(m_vertexBuffers, id) = nullptr;
+            }
+        }
+        return true;
+    case CommandBindPipeline:
+    case CommandBindTexture:
+    case CommandBindVertexBuffer:
+        if (!reader.read(id)) {
+            return false;
+        }
+
+        if (issue) {
+            if (command == CommandBindPipeline) {
+                m_renderer.bind_pipeline(pipeline(id));
+            } else if (command == CommandBindTexture) {
+                m_renderer.bind_texture(lookup(m_textures, id));
+            } else {
+                m_renderer.bind_vertex_buffer(lookup(m_vertexBuffers, id));
+            }
+        }
+        return true;
+    case CommandSetView: {
+        float matrix[16];
+        if (!reader.read(matrix)) {
+            return false;
+        }
+
+        if (issue) {
+            m_view = Matrix4(matrix);
+        }
+        return true;
+    }
+    case CommandDraw:
+    case CommandDrawQuads: {
+        uint32_t first, count, textureID, pipelineID;
+        Affine2D transform;
+        float z;
+        uint8_t layer;
+        if (!reader.read(id) || !reader.read(first) || !reader.read(count) ||
+            !reader.read(transform) || !reader.read(z) || !reader.read(textureID) ||
+            !reader.read(pipelineID) || !reader.read(layer)) {
+            return false;
+        }
+
+        if ((id & transientID) && (id & ~transientID) >= m_transientSizes.size()) {
+            return false;
+        }
+
+        if (!issue) {
+            return true;
+        }
+
+        void* buffer = nullptr;
+        if (id & transientID) {
+            // Null if the replaying renderer failed to allocate it
+            const Renderer::TransientAllocation allocation =
+                lookup(m_transients, id & ~transientID);
+            buffer = allocation.vertexBuffer;
+            first += allocation.first_vertex();
+        } else {
+            buffer = lookup(m_vertexBuffers, id);
+        }
+
+        if (!buffer) {
+            return true;
+        }
+
+        if (command == CommandDraw) {
+            m_renderer.draw(buffer, first, count, transform.to_matrix4(z), m_view,
+                            lookup(m_textures, textureID), pipeline(pipelineID), layer);
+        } else {
+            m_renderer.draw_quads(buffer, first, count, transform.to_matrix4(z), m_view,
+                                  lookup(m_textures, textureID), pipeline(pipelineID), layer);
+        }
+        return true;
+    }
+    case CommandDrawInstanced: {
+        uint32_t count, textureID, pipelineID;
+        const uint8_t* instances = nullptr;
+        uint8_t layer;
+        if (!reader.read(count) ||
+            !(instances = reader.read_bytes(sizeof(SpriteInstance) * count)) ||
+            !reader.read(textureID) || !reader.read(pipelineID) || !reader.read(layer)) {
+            return false;
+        }
+
+        if (issue) {
+            std::vector<SpriteInstance> copy(count);
+            std::memcpy(copy.data(), instances, sizeof(SpriteInstance) * count);
+            m_renderer.draw_instanced(copy.data(), count, m_view, lookup(m_textures, textureID),
+                                      pipeline(pipelineID), layer);
+        }
+        return true;
+    }
+    case CommandAllocateTransient: {
+        uint32_t size;
+        if (!reader.read(size)) {
+            return false;
+        }
+
+        m_transientSizes.push_back(size);
+        if (issue) {
+            m_transients.push_back(m_renderer.allocate_transient(size));
+        }
+        return true;
+    }
+    case CommandUpdateTransient: {
+        uint32_t index, size;
+        const uint8_t* data = nullptr;
+        if (!reader.read(index) || !reader.read(size) || !(data = reader.read_bytes(size)) ||
+            index >= m_transientSizes.size() || size > m_transientSizes[index]) {
+            return false;
+        }
+
+        if (issue) {
+            if (void* mapping = lookup(m_transients, index).data) {
+                std::memcpy(mapping, data, size);
+            }
+        }
+        return true;
+    }
+    default:
+        return false;
+    }
+}
+
+RenderPipeline::PipelineHandle CaptureReplay::pipeline(uint32_t id) {
+    switch (id) {
+    case 0:
+        return nullptr;
+    case PipelineDefault:
+        return m_renderer.default_pipeline().handle();
+    case PipelineDefaultBatch:
+        return m_renderer.default_batch_pipeline().handle();
+    case PipelineDefaultInstanced:
+        return m_renderer.default_instanced_pipeline().handle();
+    case PipelineDefaultSDF:
+        return m_renderer.default_sdf_pipeline().handle();
+    case PipelineDefaultSDFInstanced:
+        return m_renderer.default_sdf_instanced_pipeline().handle();
+    default:
+        return lookup(m_pipelines, id);
+    }
+}
+
+} // namespace Arclight::Rendering
@@ -2,72 +2,297 @@
 
 #include <Arclight/Core/Fatal.h>
 #include <Arclight/Core/Job.h>
+#include <Arclight/Core/ParallelFor.h>
+#include <Arclight/Core/RadixSort.h>
 #include <Arclight/Core/ThreadPool.h>
 
+#include <algorithm>
+#include <atomic>
+#include <bit>
 #include <cassert>
+
 namespace Arclight::Rendering {
 
+// Draws per sort key job
+#define RENDERER_SORT_KEY_GRAIN_SIZE 4096
+
+static_assert(RENDERER_TRANSIENT_ALIGNMENT % sizeof(Vertex) == 0,
+              "Transient allocations must start at a whole vertex");
+
+namespace {
+
+// Key layout, most significant first:
+//     layer          8 bits
+//     depth         24 bits
+//     pipeline       8 bits
+//     texture       12 bits
+//     vertex buffer 12 bits
+// Handles are hashed, a collision only costs a redundant bind
+// as render() compares the handles themselves.
+ALWAYS_INLINE uint64_t handle_bits(const void* handle, unsigned bits) {
+    uint64_t h = reinterpret_cast<uintptr_t>(handle);
+    h ^= h >> 31;
+    h *= 0x9e3779b97f4a7c15ull;
+    return h >> (64 - bits);
+}
+
+// Greater z is further away (GL_LESS depth test),
+// draw far to near so blending works
+ALWAYS_INLINE uint64_t depth_bits(float z) {
+    uint32_t bits = std::bit_cast<uint32_t>(z);
+    // Make the float bits sort like the float
+    bits = (bits & 0x80000000) ? ~bits : (bits | 0x80000000);
+    return ~bits >> 8;
+}
+
+} // namespace
+
+uint64_t Renderer::sort_key(const DrawCall& drawCall) {
+    return (uint64_t(drawCall.layer) << 56) |
+           (depth_bits(drawCall.zIndex) << 32) |
+           (handle_bits(drawCall.pipeline, 8) << 24) | (handle_bits(drawCall.texture, 12) << 12) |
+           handle_bits(drawCall.vertexBuffer, 12);
+}
+
+static std::atomic<uint64_t> s_nextRendererID = 1;
+
+Renderer::Renderer() : m_id(s_nextRendererID.fetch_add(1, std::memory_order_relaxed)) {}
+
 void Renderer::render() {
-    // Each pipeline has a queue
-    // For each entry bind texture -> bind vertex buffer -> perform call
-    // In future may want to order by texture, etc.
-    std::scoped_lock lockQueue(m_draw_queue_mutex);
+    std::scoped_lock lockBuffers(m_submissionBuffersMutex);
+
+    size_t callCount = 0;
+    for (auto& [thread, buffer] : m_submissionBuffers) {
+        callCount += buffer->calls.size();
+    }
+
+    if (!callCount) {
+        return;
+    }
+
+    // Merge the buffers, view tables and instances of every thread
+    m_sortedDrawCalls.resize(callCount);
+    m_views.clear();
+    m_instances.clear();
+    size_t offset = 0;
+    for (auto& [thread, buffer] : m_submissionBuffers) {
+        std::vector<DrawCall>& calls = buffer->calls;
+        SortedDrawCall* sorted = m_sortedDrawCalls.data() + offset;
+        const uint32_t viewBase = static_cast<uint32_t>(m_views.size());
+        const uint32_t instanceBase = static_cast<uint32_t>(m_instances.size());
 
-    for (auto& bucket : m_queues) {
-        bind_pipeline(bucket.first);
+        const bool sort = m_sortDrawCalls;
+        parallel_for(calls.size(), RENDERER_SORT_KEY_GRAIN_SIZE,
+                     [&calls, sorted, viewBase, instanceBase, sort](size_t begin, size_t end) {
+                         for (size_t i = begin; i < end; i++) {
+                             calls[i].viewIndex += viewBase;
+                             if (calls[i].instanced) {
+                                 calls[i].firstVertex += instanceBase;
+                             }
 
-        auto& q = bucket.second;
+                             sorted[i] = {sort ? sort_key(calls[i]) : 0, &calls[i]};
+                         }
+                     });
 
-        DrawCall* call = q.calls;
-        while (q.callCount) {
-            if (call->texture) {
-                bind_texture(call->texture);
+        m_views.insert(m_views.end(), buffer->views.begin(), buffer->views.end());
+        m_instances.insert(m_instances.end(), buffer->instances.begin(),
+                           buffer->instances.end());
+        offset += calls.size();
+    }
+
+    if (!m_instances.empty()) {
+        upload_instances(m_instances.data(), static_cast<unsigned>(m_instances.size()));
+    }
+
+    if (m_sortDrawCalls) {
+        // Stable, draws with equal keys stay in submission order
+        parallel_radix_sort(m_sortedDrawCalls, m_sortScratch,
+                            [](const SortedDrawCall& call) { return call.key; });
+    }
+
+    const bool bindless = has_bindless_textures();
+
+    RenderPipeline::PipelineHandle boundPipeline = nullptr;
+    // Pipeline destroyed after draws were queued with it
+    RenderPipeline::PipelineHandle stalePipeline = nullptr;
+    Texture::TextureHandle boundTexture = nullptr;
+    bool textureBound = false; // boundTexture is bound in the backend, even if it is nullptr
+    void* boundVertexBuffer = nullptr;
+    for (const SortedDrawCall& sorted : m_sortedDrawCalls) {
+        const DrawCall& call = *sorted.call;
+
+        if (call.pipeline != boundPipeline) {
+            if (call.pipeline == stalePipeline || !pipeline_valid(call.pipeline)) {
+                stalePipeline = call.pipeline;
+                continue;
             }
 
-            bind_vertex_buffer(call->vertexBuffer);
-            do_draw_call(call->firstVertex, call->vertexCount, call->transform, call->view);
+            bind_pipeline(call.pipeline);
+            boundPipeline = call.pipeline;
 
-            call++;
-            q.callCount--;
+            // Bindings may be per pipeline in the backend
+            textureBound = false;
+            boundVertexBuffer = nullptr;
+        }
+
+        // No texture keeps whatever was bound before,
+        // except for instanced draws sampling the bindless texture of each instance
+        const bool bindTexture = call.texture || (call.instanced && bindless);
+        if (bindTexture && (!textureBound || call.texture != boundTexture)) {
+            bind_texture(call.texture);
+            boundTexture = call.texture;
+            textureBound = true;
+        }
+
+        // Instanced draws use the backend's unit quad and instance buffers
+        if (call.vertexBuffer && call.vertexBuffer != boundVertexBuffer) {
+            bind_vertex_buffer(call.vertexBuffer);
+            boundVertexBuffer = call.vertexBuffer;
+        }
+
+        const Matrix4& view = m_views[call.viewIndex];
+        if (call.instanced) {
+            do_draw_instanced_call(call.firstVertex, call.vertexCount, view);
+            continue;
+        }
+
+        const Matrix4 transform = call.transform.to_matrix4(call.zIndex);
+        if (call.indexCount) {
+            do_draw_indexed_call(call.firstVertex, call.indexCount, transform, view);
+        } else {
+            do_draw_call(call.firstVertex, call.vertexCount, transform, view);
         }
+    }
 
-        assert(!q.callCount);
+    for (auto& [thread, buffer] : m_submissionBuffers) {
+        buffer->calls.clear();
+        buffer->views.clear();
+        buffer->instances.clear();
     }
 }
 
 void Renderer::draw(void* vertexBuffer, unsigned firstVertex, unsigned vertexCount,
                     const Matrix4& transform, const Matrix4& view, Texture::TextureHandle texture,
-                    RenderPipeline::PipelineHandle renderPipeline) {
+                    RenderPipeline::PipelineHandle renderPipeline, uint8_t layer) {
     if(!renderPipeline) {
         renderPipeline = RenderPipeline::default_pipeline().handle();
     }
-    
-    std::scoped_lock lockQueue(m_draw_queue_mutex);
 
-    auto& q = m_queues[renderPipeline];
-    if(q.callCount >= q.size) {
-        if(q.calls) {
-            q.size += 1000;
-            q.calls = (DrawCall*)realloc(q.calls, q.size * sizeof(DrawCall));
-            if(q.calls == nullptr) {
-                FatalRuntimeError("realloc failed!");
-            }
-        } else {
-            q.size = 8000;
-            q.calls = (DrawCall*)malloc(q.size * sizeof(DrawCall));
-            assert(q.calls);
+    SubmissionBuffer& buffer = submission_buffer();
+    buffer.calls.push_back(DrawCall{Affine2D::from_matrix4(transform), transform.matrix()[14],
+                                    buffer.view_index(view), firstVertex, vertexCount, 0,
+                                    vertexBuffer, texture, renderPipeline, layer, false});
+}
+
+void Renderer::draw_quads(void* vertexBuffer, unsigned firstVertex, unsigned quadCount,
+                          const Matrix4& transform, const Matrix4& view,
+                          Texture::TextureHandle texture,
+                          RenderPipeline::PipelineHandle renderPipeline, uint8_t layer) {
+    if (!renderPipeline) {
+        renderPipeline = default_batch_pipeline().handle();
+    }
+
+    SubmissionBuffer& buffer = submission_buffer();
+    buffer.calls.push_back(DrawCall{Affine2D::from_matrix4(transform), transform.matrix()[14],
+                                    buffer.view_index(view), firstVertex, quadCount * 4,
+                                    quadCount * 6, vertexBuffer, texture, renderPipeline, layer,
+                                    false});
+}
+
+void Renderer::draw_instanced(const SpriteInstance* instances, unsigned instanceCount,
+                              const Matrix4& view, Texture::TextureHandle texture,
+                              RenderPipeline::PipelineHandle renderPipeline, uint8_t layer) {
+    if (!instanceCount) {
+        return;
+    }
+
+    if (!renderPipeline) {
+        renderPipeline = default_instanced_pipeline().handle();
+    }
+
+    SubmissionBuffer& buffer = submission_buffer();
+    const unsigned firstInstance = static_cast<unsigned>(buffer.instances.size());
+    buffer.instances.insert(buffer.instances.end(), instances, instances + instanceCount);
+
+    buffer.calls.push_back(DrawCall{Affine2D{}, instances[0].translation[2],
+                                    buffer.view_index(view), firstInstance, instanceCount, 0,
+                                    nullptr, texture, renderPipeline, layer, true});
+}
+
+Renderer::TransientAllocation Renderer::TransientChain::allocate(Renderer& renderer,
+                                                                size_t size) {
+    TransientBlock* block = m_blocks.empty() ? nullptr : &m_blocks.back();
+    size_t offset = block ? align_transient(block->used) : 0;
+    if (!block || offset + size > block->size) {
+        // Earlier allocations of the frame may still be written to, chain a new block.
+        // Grow geometrically so growing scenes do not overflow every frame
+        const size_t blockSize = block ? block->size * 2 : m_initialBlockSize;
+        TransientBlock newBlock = renderer.create_transient_block(std::max(size, blockSize));
+        if (!newBlock.data) {
+            return {};
         }
+
+        block = &m_blocks.emplace_back(newBlock);
+        offset = 0;
     }
 
-    assert(q.callCount < q.size);
-    q.calls[q.callCount++] = DrawCall{firstVertex, vertexCount, transform, view, vertexBuffer, texture};
+    // As if the whole frame was allocated from one block
+    m_frameSize = align_transient(m_frameSize) + size;
+    block->used = offset + size;
+
+    return {block->data + offset, block->vertexBuffer, offset};
 }
 
-void Renderer::destroy_pipeline(RenderPipeline::PipelineHandle handle) {
-    assert(handle);
+void Renderer::TransientChain::reset(Renderer& renderer) {
+    if (m_blocks.size() > 1) {
+        // Leave headroom so slowly growing scenes do not overflow every frame
+        const size_t blockSize = m_frameSize + m_frameSize / 2;
+        destroy(renderer);
+
+        TransientBlock block = renderer.create_transient_block(blockSize);
+        if (block.data) {
+            m_blocks.push_back(block);
+        }
+    }
+
+    for (TransientBlock& block : m_blocks) {
+        block.used = 0;
+    }
+    m_frameSize = 0;
+}
+
+void Renderer::TransientChain::destroy(Renderer& renderer) {
+    for (const TransientBlock& block : m_blocks) {
+        renderer.destroy_transient_block(block);
+    }
+
+    m_blocks.clear();
+    m_frameSize = 0;
+}
+
+Renderer::SubmissionBuffer& Renderer::submission_buffer() {
+    // Most threads only ever submit to one renderer
+    thread_local uint64_t cachedRenderer = 0;
+    thread_local SubmissionBuffer* cachedBuffer = nullptr;
+
+    if (cachedRenderer == m_id) {
+        return *cachedBuffer;
+    }
+
+    std::unique_lock lock(m_submissionBuffersMutex);
+
+    const std::thread::id thread = std::this_thread::get_id();
+    auto it = std::find_if(m_submissionBuffers.begin(), m_submissionBuffers.end(),
+                           [thread](const auto& entry) { return entry.first == thread; });
+
+    if (it == m_submissionBuffers.end()) {
+        m_submissionBuffers.emplace_back(thread, std::make_unique<SubmissionBuffer>());
+        it = m_submissionBuffers.end() - 1;
+    }
 
-    std::scoped_lock lockQueue(m_draw_queue_mutex);
-    m_queues.erase(handle);
+    cachedRenderer = m_id;
+    cachedBuffer = it->second.get();
+    return *cachedBuffer;
 }
 
 Renderer* Renderer::s_rendererInstance = nullptr;
@@ -1,52 +1,18 @@
 #include <Arclight/Graphics/Text.h>
 
+#include <algorithm>
 #include <cassert>
 
 #include <Arclight/Core/Fatal.h>
 #include <Arclight/Core/File.h>
 #include <Arclight/Core/Logger.h>
+#include <Arclight/Graphics/GlyphCache.h>
 #include <Arclight/Graphics/Texture.h>
 
 #ifndef NO_ICU
 #include <unicode/schriter.h>
 #endif
 
-#include "Freetype.h"
-
-FreeType* FreeType::m_instance = new FreeType();
-
-FreeType::FreeType() {
-    assert(!m_instance);
-    m_instance = this;
-
-    Arclight::Logger::Debug("Initializing Freetype!");
-
-    if (FT_Error e = FT_Init_FreeType(&m_library); e) {
-        Arclight::Logger::Error("Error {} initializing freetype!", FT_Error_String(e));
-        FatalRuntimeError("Failed to initialize Freetype!");
-    }
-}
-
-FT_Error FreeType::NewFace(Arclight::File* file, FT_Long index, FT_Face* outFace,
-                           std::vector<uint8_t>& outData) {
-    std::unique_lock lockFT(m_lock);
-
-    size_t fSize = file->get_size();
-    outData.resize(fSize);
-
-    if (file->Read(outData.data(), fSize) < 0) {
-        return FT_Err_Cannot_Open_Resource;
-    }
-
-    return FT_New_Memory_Face(m_library, outData.data(), fSize, index, outFace);
-}
-
-FT_Error FreeType::DoneFace(FT_Face face) {
-    std::unique_lock lockFT(m_lock);
-
-    return FT_Done_Face(face);
-}
-
 namespace Arclight {
 
 Text::Text() {}
@@ -59,154 +25,80 @@ Text::Text() {}
 Text::Text(const UnicodeString& text) { SetText(text); }
 
 void Text::render() {
+    m_vertices.clear();
+    m_quadTextures.clear();
+    m_bounds = Rectf(Vector2f{0.f, 0.f});
+
     if (!m_font.get()) {
         return;
     }
 
-    std::unique_lock fontLock(m_font->m_lock);
-    FT_Face face = reinterpret_cast<FT_Face>(m_font->m_handle);
+    GlyphCache& cache = m_font->glyph_cache(m_pixelSize);
+    m_sdf = cache.is_sdf();
 
-    if (FT_Set_Pixel_Sizes(face, 0, m_pixelSize)) {
-        Arclight::Logger::Error("Failed to set font size!");
-        return;
-    }
+    // SDF caches are generated at one size and scaled to the others
+    const float scale = static_cast<float>(m_pixelSize) / cache.pixel_size();
+    const float lineHeight = cache.line_height() * scale;
+    const float ascender = cache.ascender() * scale;
+
+    float xPos = 0;
+    float yPos = 0;
+    float width = 0;
+    uint32_t prevGlyph = 0;
+
+    auto add_glyph = [&](uint32_t codepoint) {
+        if (codepoint == '\n') {
+            yPos += lineHeight;
+            xPos = 0;
+            prevGlyph = 0;
+            return;
+        } else if (codepoint == '\r') { // Ignore carriage returns
+            return;
+        }
 
-    bool useKerning = FT_HAS_KERNING(face);
-    // In 64ths of a pixel so r shift by 6
-    unsigned int pixelLineHeight = face->size->metrics.height >> 6;
-    Vector2u texBounds = {0, pixelLineHeight};
+        GlyphCache::Glyph glyph = cache.glyph(codepoint);
+        // Offset the x position for kerning
+        xPos += cache.kerning(prevGlyph, glyph.index) * scale;
+
+        if (glyph.region.valid()) {
+            // Ascender is the difference between the top of the line and the baseline
+            const float left = xPos + glyph.bearing.x * scale;
+            const float top = yPos + ascender - glyph.bearing.y * scale;
+            const float right = left + glyph.region.size.x * scale;
+            const float bottom = top + glyph.region.size.y * scale;
+            const Rectf& uv = glyph.region.textureCoordinates;
+
+            m_vertices.push_back({{left, bottom}, {uv.left, uv.bottom}, m_colour});
+            m_vertices.push_back({{left, top}, {uv.left, uv.top}, m_colour});
+            m_vertices.push_back({{right, bottom}, {uv.right, uv.bottom}, m_colour});
+            m_vertices.push_back({{right, top}, {uv.right, uv.top}, m_colour});
+            m_quadTextures.push_back(glyph.region.texture->handle());
+        }
 
-    // Compose a vector of glyphs
-    std::vector<unsigned int> glyphs;
+        // Advance the x position
+        xPos += glyph.advance * scale;
+        width = std::max(width, xPos);
+        prevGlyph = glyph.index;
+    };
 
 #ifdef NO_ICU
     for (int codepoint : m_text) {
-        if (codepoint == '\n') {
-            texBounds.y += pixelLineHeight;
-            glyphs.push_back('\n');
-        } else if (codepoint != '\r') { // Ignore carriage returns
-            glyphs.push_back(FT_Get_Char_Index(face, codepoint));
-        }
+        add_glyph(static_cast<uint32_t>(codepoint));
     }
 #else
     icu::StringCharacterIterator it(m_text);
     UChar32 codepoint = it.next32PostInc();
     while (codepoint != icu::StringCharacterIterator::DONE) {
-        if (codepoint == '\n') {
-            texBounds.y += pixelLineHeight;
-            glyphs.push_back('\n');
-        } else if (codepoint != '\r') { // Ignore carriage returns
-            glyphs.push_back(FT_Get_Char_Index(face, codepoint));
-        }
+        add_glyph(static_cast<uint32_t>(codepoint));
 
         codepoint = it.next32PostInc();
     }
 #endif
 
-    if (glyphs.size() == 0) {
-        return;
-    }
+    m_bounds = Rectf(Vector2f{width, yPos + lineHeight});
 
-    unsigned int prevGlyph = 0;
-    for (unsigned int glyph : glyphs) {
-        if (glyph == '\n') {
-            continue;
-        }
-
-        if (useKerning && prevGlyph) {
-            FT_Vector kerning;
-            FT_Get_Kerning(face, prevGlyph, glyph, FT_KERNING_DEFAULT, &kerning);
-            texBounds.x += kerning.x >> 6;
-        }
-
-        if (!FT_Load_Glyph(face, glyph, FT_LOAD_ADVANCE_ONLY)) {
-            texBounds.x += face->glyph->metrics.horiAdvance >> 6;
-        }
-
-        prevGlyph = glyph;
-    }
-
-    // Round up to multiple of 4 bytes
-    texBounds.x = (texBounds.x + 3) & (~3U);
-
-    // Unlock the font face whilst we reallocate texture
-    fontLock.unlock();
-    m_bounds = Rectf(vector_static_cast<float>(texBounds));
-    m_texture.Reallocate(texBounds, Texture::Format::Format_A8_SRGB);
-
-    // Font textures are graysacle with one bit per pixel
-    uint8_t* pixelBuffer = new uint8_t[texBounds.x * texBounds.y];
-    // Make sure incase any pixels arent written they are transparent
-    memset(pixelBuffer, 0, texBounds.x * texBounds.y);
-
-    // Lock the font again
-    fontLock.lock();
-    // Set pixel sizes again incase it has been changed by another thread
-    if (FT_Set_Pixel_Sizes(face, 0, m_pixelSize)) {
-        Arclight::Logger::Error("Failed to set font size!");
-        return;
-    }
-
-    int xPos = 0;
-    int yPos = 0;
-    prevGlyph = 0;
-    for (unsigned int glyph : glyphs) {
-        if (glyph == '\n') {
-            yPos += static_cast<int>(pixelLineHeight);
-            xPos = 0;
-            continue;
-        }
-
-        if (useKerning) {
-            if (prevGlyph) {
-                FT_Vector kerning;
-                FT_Get_Kerning(face, prevGlyph, glyph, FT_KERNING_DEFAULT, &kerning);
-                xPos += kerning.x >> 6; // Offset the x position for kerning
-            }
-        }
-
-        if (FT_Load_Glyph(face, glyph, FT_LOAD_RENDER)) {
-            continue;
-        }
-        FT_GlyphSlot slot = face->glyph;
-
-        // Start of the font blit
-        // Ascender is the difference between the baseline and the top of the glyph
-        int yOffset = yPos + (face->size->metrics.ascender >> 6) - slot->bitmap_top;
-        assert(yOffset >= 0);
-
-        int xOffset = 0;
-        if (!useKerning) {
-            xOffset = face->glyph->metrics.horiBearingX >> 6;
-        }
-
-        // Copy the glyph into the texture
-        for (unsigned int y = 0; y < slot->bitmap.rows; y++) {
-            assert(yOffset + y <= texBounds.y);
-
-            memcpy(&pixelBuffer[(yOffset + y) * texBounds.x + xPos + xOffset],
-                   &slot->bitmap.buffer[y * slot->bitmap.pitch], slot->bitmap.width);
-        }
-
-        // Advance the x position
-        xPos += face->glyph->metrics.horiAdvance >> 6;
-        prevGlyph = glyph;
-    }
-    // No longer need the face
-    fontLock.unlock();
-
-    // Copy the pixel buffer into the texture
-    m_texture.Update(pixelBuffer);
-    delete pixelBuffer;
-
-    m_vertices[0].position = Vector2f{0, m_bounds.height()};
-    m_vertices[0].texCoord = Vector2f{0, 1.f};
-    m_vertices[1].position = Vector2f{0, 0};
-    m_vertices[1].texCoord = Vector2f{0, 0};
-    m_vertices[2].position = Vector2f{m_bounds.width(), m_bounds.height()};
-    m_vertices[2].texCoord = Vector2f{1.f, 1.f};
-    m_vertices[3].position = Vector2f{m_bounds.width(), 0};
-    m_vertices[3].texCoord = Vector2f{1.f, 0};
+    // Upload any glyphs rasterised for this text
+    cache.flush();
 }
 
 void Text::SetFont(std::shared_ptr<Font> font) {
@@ -215,6 +107,15 @@ void Text::SetFont(std::shared_ptr<Font> font) {
     render();
 }
 
+void Text::SetColour(const Colour& colour) {
+    m_colour = colour.AsFloat();
+
+    // Only the vertices change
+    for (Vertex& v : m_vertices) {
+        v.colour = m_colour;
+    }
+}
+
 void Text::SetText(UnicodeString text) {
     m_text = std::move(text);
 
@@ -0,0 +1,192 @@
+#include <Arclight/Graphics/TextureAtlas.h>
+
+#include <Arclight/Core/Logger.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+
+namespace Arclight {
+
+SkylinePacker::SkylinePacker(const Vector2u& size) : m_size(size) { clear(); }
+
+bool SkylinePacker::insert(const Vector2u& size, Vector2u& position) {
+    size_t best = SIZE_MAX;
+    uint32_t bestY = UINT32_MAX;
+    uint32_t bestBottom = UINT32_MAX;
+    uint32_t bestWidth = UINT32_MAX;
+
+    // Lowest bottom edge wins, ties go to the narrowest segment to leave wide gaps open
+    for (size_t i = 0; i < m_skyline.size(); i++) {
+        uint32_t y = fit(i, size);
+        if (y == UINT32_MAX) {
+            continue;
+        }
+
+        uint32_t bottom = y + size.y;
+        if (bottom < bestBottom || (bottom == bestBottom && m_skyline[i].width < bestWidth)) {
+            best = i;
+            bestY = y;
+            bestBottom = bottom;
+            bestWidth = m_skyline[i].width;
+        }
+    }
+
+    if (best == SIZE_MAX) {
+        return false;
+    }
+
+    position = {m_skyline[best].x, bestY};
+    m_skyline.insert(m_skyline.begin() + best, Segment{position.x, bestBottom, size.x});
+
+    // Cut away the segments now under the rectangle
+    for (size_t i = best + 1; i < m_skyline.size();) {
+        const Segment& previous = m_skyline[i - 1];
+        Segment& segment = m_skyline[i];
+
+        uint32_t previousEnd = previous.x + previous.width;
+        if (segment.x >= previousEnd) {
+            break;
+        }
+
+        uint32_t overlap = previousEnd - segment.x;
+        if (segment.width <= overlap) {
+            m_skyline.erase(m_skyline.begin() + i);
+            continue;
+        }
+
+        segment.x += overlap;
+        segment.width -= overlap;
+        break;
+    }
+
+    // Merge neighbours at the same height
+    for (size_t i = 0; i + 1 < m_skyline.size();) {
+        if (m_skyline[i].y == m_skyline[i + 1].y) {
+            m_skyline[i].width += m_skyline[i + 1].width;
+            m_skyline.erase(m_skyline.begin() + i + 1);
+        } else {
+            i++;
+        }
+    }
+
+    return true;
+}
+
+void SkylinePacker::clear() {
+    m_skyline.clear();
+    m_skyline.push_back({0, 0, m_size.x});
+}
+
+uint32_t SkylinePacker::fit(size_t index, const Vector2u& size) const {
+    const uint32_t x = m_skyline[index].x;
+    if (x + size.x > m_size.x) {
+        return UINT32_MAX;
+    }
+
+    // The rectangle rests on the highest segment it spans
+    uint32_t y = 0;
+    int64_t widthLeft = size.x;
+    for (size_t i = index; widthLeft > 0; i++) {
+        assert(i < m_skyline.size());
+
+        y = std::max(y, m_skyline[i].y);
+        if (y + size.y > m_size.y) {
+            return UINT32_MAX;
+        }
+
+        widthLeft -= m_skyline[i].width;
+    }
+
+    return y;
+}
+
+void TextureAtlas::Region::remap(Sprite& sprite) const {
+    const float width = textureCoordinates.right - textureCoordinates.left;
+    const float height = textureCoordinates.bottom - textureCoordinates.top;
+
+    for (Vertex& v : sprite.vertices) {
+        v.texCoord = {textureCoordinates.left + v.texCoord.x * width,
+                      textureCoordinates.top + v.texCoord.y * height};
+    }
+
+    sprite.texture = texture;
+}
+
+TextureAtlas::Page::Page(const Vector2u& size, Texture::Format format)
+    : texture(size, format), pixels(size.x * size.y * Texture::formatSizes[format], 0),
+      packer(size) {}
+
+TextureAtlas::TextureAtlas(const Vector2u& pageSize, Texture::Format format)
+    : m_pageSize(pageSize), m_format(format) {}
+
+TextureAtlas::Region TextureAtlas::add(const Image& image) {
+    assert(m_format == Texture::Format_RGBA8_SRGB);
+
+    return add(reinterpret_cast<const uint8_t*>(image.Data()),
+               {static_cast<unsigned>(image.Size().x), static_cast<unsigned>(image.Size().y)});
+}
+
+TextureAtlas::Region TextureAtlas::add(const uint8_t* pixelData, const Vector2u& size) {
+    if (!size.x || !size.y) {
+        Logger::Warning("TextureAtlas::add: Image has no pixels");
+        return {};
+    }
+
+    const Vector2u paddedSize = {size.x + TEXTUREATLAS_PADDING, size.y + TEXTUREATLAS_PADDING};
+
+    Vector2u position;
+    for (auto& page : m_pages) {
+        if (page->packer.insert(paddedSize, position)) {
+            return place(*page, position, pixelData, size);
+        }
+    }
+
+    // Nothing has space, images larger than a page get a page of their own
+    const Vector2u pageSize = {std::max(m_pageSize.x, paddedSize.x),
+                               std::max(m_pageSize.y, paddedSize.y)};
+    Page& page = *m_pages.emplace_back(std::make_unique<Page>(pageSize, m_format));
+
+    bool inserted = page.packer.insert(paddedSize, position);
+    assert(inserted);
+    (void)inserted;
+
+    return place(page, position, pixelData, size);
+}
+
+void TextureAtlas::flush() {
+    for (auto& page : m_pages) {
+        if (page->dirty) {
+            page->texture.Update(page->pixels.data());
+            page->dirty = false;
+        }
+    }
+}
+
+void TextureAtlas::clear() { m_pages.clear(); }
+
+TextureAtlas::Region TextureAtlas::place(Page& page, const Vector2u& position,
+                                         const uint8_t* pixelData, const Vector2u& size) {
+    const Vector2u& pageSize = page.packer.size();
+    const unsigned pixelSize = Texture::formatSizes[m_format];
+    const size_t rowSize = size.x * pixelSize;
+
+    for (unsigned y = 0; y < size.y; y++) {
+        uint8_t* row =
+            page.pixels.data() + (static_cast<size_t>(position.y + y) * pageSize.x + position.x) *
+                                     pixelSize;
+        memcpy(row, pixelData + y * rowSize, rowSize);
+    }
+    page.dirty = true;
+
+    const Vector2f scale = {1.f / pageSize.x, 1.f / pageSize.y};
+    return Region{
+        .texture = &page.texture,
+        .textureCoordinates = Rectf(Vector2f{position.x * scale.x, position.y * scale.y},
+                                    Vector2f{(position.x + size.x) * scale.x,
+                                             (position.y + size.y) * scale.y}),
+        .size = {static_cast<int>(size.x), static_cast<int>(size.y)},
+    };
+}
+
+} // namespace Arclight
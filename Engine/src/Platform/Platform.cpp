@@ -1,15 +1,26 @@
 #include <Arclight/Core/Fatal.h>
 #include <Arclight/Core/Logger.h>
+#include <Arclight/Graphics/Rendering/RenderCapture.h>
 #include <Arclight/Graphics/Rendering/Renderer.h>
 #include <Arclight/Platform/Platform.h>
 #include <Arclight/Window/WindowContext.h>
 
 #include <cassert>
+#include <cstdlib>
+#include <filesystem>
+#include <system_error>
 #include <thread>
 
 #include <SDL.h>
 #include <SDL_video.h>
 
+#if defined(ARCLIGHT_PLATFORM_UNIX) && !defined(ARCLIGHT_PLATFORM_MACOS)
+#include <cerrno>
+#include <cstring>
+
+#include <sys/stat.h>
+#endif
+
 #ifdef ARCLIGHT_VULKAN
 #include <SDL_vulkan.h>
 #include <vulkan/vulkan.h>
@@ -17,8 +28,8 @@
 #include <Rendering/Vulkan/VulkanRenderer.h>
 #endif
 
-#ifdef ARCLIGHT_DUMMY_RENDERER
-#include <Rendering/Dummy/DummyRenderer.h>
+#ifdef ARCLIGHT_SOFTWARE_RENDERER
+#include <Rendering/Software/SoftwareRenderer.h>
 #endif
 
 #ifdef ARCLIGHT_OPENGL
@@ -76,13 +87,6 @@ void Initialize() {
     }
 #endif
 
-#ifdef ARCLIGHT_DUMMY_RENDERER
-    Rendering::DummyRenderer* dummyRenderer = new Rendering::DummyRenderer();
-    if (!dummyRenderer->initialize(windowContext)) {
-        renderers.push_back(dummyRenderer);
-    }
-#endif
-
 #ifdef ARCLIGHT_OPENGL
     Rendering::GLRenderer* glRenderer = new Rendering::GLRenderer();
     if (!glRenderer->initialize(windowContext)) {
@@ -97,17 +101,41 @@ void Initialize() {
     }
 #endif
 
+#ifdef ARCLIGHT_SOFTWARE_RENDERER
+    // Fallback when no GPU renderer is available
+    if (renderers.empty()) {
+        Rendering::SoftwareRenderer* softwareRenderer = new Rendering::SoftwareRenderer();
+        if (!softwareRenderer->initialize(windowContext)) {
+            renderers.push_back(softwareRenderer);
+        }
+    }
+#endif
+
     if (!renderers.size() || !Rendering::Renderer::instance()) {
         Logger::Error("No available rendering API!");
         exit(2);
     }
+
+#ifndef ARCLIGHT_PLATFORM_WASM
+    // Record everything rendered for arclight-replay
+    if (const char* capturePath = getenv("ARCLIGHT_RENDER_CAPTURE")) {
+        Rendering::CaptureRenderer* captureRenderer =
+            new Rendering::CaptureRenderer(*Rendering::Renderer::instance(), capturePath);
+        if (!captureRenderer->initialize(windowContext)) {
+            renderers.push_back(captureRenderer);
+        } else {
+            delete captureRenderer;
+        }
+    }
+#endif
 }
 
 void Cleanup() {
     SDL_DestroyWindow(sdlWindow);
 
-    for (auto* renderer : renderers) {
-        delete renderer;
+    // Wrappers like CaptureRenderer go before the renderer they wrap
+    for (auto it = renderers.rbegin(); it != renderers.rend(); it++) {
+        delete *it;
     }
     renderers.clear();
 }
@@ -133,4 +161,62 @@ bool multithreading_enabled() {
     return false;
 }
 
+std::string user_cache_directory() {
+#if defined(ARCLIGHT_PLATFORM_WASM)
+    return {};
+#elif defined(ARCLIGHT_PLATFORM_UNIX) && !defined(ARCLIGHT_PLATFORM_MACOS)
+    // XDG base directory specification, defaulting to ~/.cache
+    std::string path;
+    if (const char* xdgCache = getenv("XDG_CACHE_HOME"); xdgCache && *xdgCache) {
+        path = xdgCache;
+    } else if (const char* home = getenv("HOME"); home && *home) {
+        path = std::string(home) + "/.cache";
+    } else {
+        return {};
+    }
+
+    // The cache directory itself may not exist yet
+    mkdir(path.c_str(), 0700);
+
+    path += "/arclight/";
+    if (mkdir(path.c_str(), 0700) && errno != EEXIST) {
+        Logger::Warning("[Platform] Failed to create cache directory {}: {}", path,
+                        strerror(errno));
+        return {};
+    }
+
+    return path;
+#else
+    // SDL creates the directory for us
+    char* prefPath = SDL_GetPrefPath("Arclight", "cache");
+    if (!prefPath) {
+        Logger::Warning("[Platform] Failed to get cache directory: {}", SDL_GetError());
+        return {};
+    }
+
+    std::string path = prefPath;
+    SDL_free(prefPath);
+    return path;
+#endif
+}
+
+std::string application_name() {
+    std::error_code error;
+    const std::u8string directory = std::filesystem::current_path(error).filename().u8string();
+
+    // Anything but plain ASCII may not be allowed in a file name
+    std::string name;
+    for (char8_t c : directory) {
+        const bool allowed = (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+                             (c >= '0' && c <= '9') || c == '-' || c == '_';
+        name += allowed ? static_cast<char>(c) : '_';
+    }
+
+    if (error || name.empty()) {
+        return "Game";
+    }
+
+    return name;
+}
+
 } // namespace Arclight::Platform
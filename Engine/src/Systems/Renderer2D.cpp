@@ -2,20 +2,211 @@
 
 #include <Arclight/Components/Camera.h>
 #include <Arclight/Components/Sprite.h>
+#include <Arclight/Components/Transform.h>
 #include <Arclight/Core/Application.h>
 #include <Arclight/Core/Logger.h>
+#include <Arclight/Core/ParallelFor.h>
+#include <Arclight/Graphics/Affine2D.h>
 #include <Arclight/Graphics/Rendering/Renderer.h>
 #include <Arclight/Graphics/Text.h>
 
+#include <algorithm>
+
+// Quads transformed per job when batching
+#define RENDERER2D_BATCH_GRAIN_SIZE 1024
+// Text objects laid out per job when batching, each is many glyph quads
+#define RENDERER2D_TEXT_GRAIN_SIZE 16
+
 namespace Arclight::Systems {
 
+namespace {
+
+ALWAYS_INLINE void transform_quad(const Vertex* in, Vertex* out, const Affine2D& transform) {
+    for (int i = 0; i < 4; i++) {
+        out[i] = in[i];
+        out[i].position = transform.apply(in[i].position);
+    }
+}
+
+// Vertices are in the order bottom left, top left, bottom right, top right
+ALWAYS_INLINE Rendering::SpriteInstance quad_instance(const Vertex* in, const Affine2D& transform,
+                                                      float zIndex) {
+    const Vertex& topLeft = in[1];
+    const Vertex& bottomRight = in[2];
+
+    return Rendering::SpriteInstance::create(
+        Rectf(topLeft.position, bottomRight.position), transform, zIndex,
+        Rectf(topLeft.texCoord, bottomRight.texCoord), in[0].colour);
+}
+
+ALWAYS_INLINE Texture::TextureHandle sprite_texture(const Sprite& sprite) {
+    return sprite.texture ? sprite.texture->handle() : nullptr;
+}
+
+// Transform every quad into world space on the CPU and
+// draw runs of quads with the same texture and z index together.
+// With instancing, quads become SpriteInstances and only the texture splits runs,
+// with bindless textures every instance carries its texture and only the shader does.
+template <typename Sprites, typename TextObjects, typename PackedSprites>
+void render_batched(Renderer2DContext& ctx, Sprites& sprites, TextObjects& textObjects,
+                    PackedSprites& packedSprites, const Matrix4& viewMatrix) {
+    Rendering::Renderer& renderer = *Rendering::Renderer::instance();
+
+    // Views have no contiguous entity array, gather them first
+    auto& packedEntities = ctx.batchEntities;
+    packedEntities.clear();
+    for (Entity ent : packedSprites) {
+        packedEntities.push_back(ent);
+    }
+
+    const size_t spriteCount = sprites.size();
+    const size_t packedCount = packedEntities.size();
+    const size_t textCount = textObjects.size();
+
+    // Every text is a run of glyph quads, find where each one starts
+    auto& textOffsets = ctx.batchTextOffsets;
+    textOffsets.resize(textCount);
+    const size_t spriteQuadCount = spriteCount + packedCount;
+    size_t quadCount = spriteQuadCount;
+    auto textEntities = textObjects.begin();
+    for (size_t i = 0; i < textCount; i++) {
+        textOffsets[i] = quadCount;
+        quadCount += textObjects.template get<Text>(textEntities[i]).quad_count();
+    }
+
+    // Quads are transformed straight into memory the GPU reads
+    Rendering::Renderer::TransientAllocation vertexAllocation;
+    Vertex* vertices = nullptr;
+    auto& instances = ctx.batchInstances;
+    auto& quads = ctx.batchQuads;
+    if (ctx.instancing) {
+        instances.resize(quadCount);
+    } else {
+        vertexAllocation = renderer.allocate_transient(quadCount * 4 * sizeof(Vertex));
+        vertices = static_cast<Vertex*>(vertexAllocation.data);
+        if (!vertices) {
+            return;
+        }
+    }
+    quads.resize(quadCount);
+
+    const bool bindless = ctx.instancing && renderer.has_bindless_textures();
+
+    // Either transform the quad on the CPU or turn it into an instance
+    auto emit = [&](size_t i, const Vertex* quad, const Affine2D& transform, float zIndex,
+                    Texture::TextureHandle texture) {
+        if (ctx.instancing) {
+            instances[i] = quad_instance(quad, transform, zIndex);
+            if (bindless && texture) {
+                instances[i].textureIndex = renderer.bindless_texture_index(texture);
+            }
+        } else {
+            transform_quad(quad, vertices + i * 4, transform);
+        }
+    };
+
+    // Keep the same order as the unbatched path: sprites, packed sprites then text
+    // Group iterators are random access
+    auto spriteEntities = sprites.begin();
+    parallel_for(spriteQuadCount, RENDERER2D_BATCH_GRAIN_SIZE, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            if (i < spriteCount) {
+                Entity ent = spriteEntities[i];
+                const Sprite& sprite = sprites.template get<Sprite>(ent);
+                Transform2D& t = sprites.template get<Transform2D>(ent);
+
+                emit(i, sprite.vertices, Affine2D::from_matrix4(t.matrix()), t.get_z_index(),
+                     sprite_texture(sprite));
+                quads[i] = {sprite_texture(sprite), t.get_z_index(), false};
+            } else {
+                Entity ent = packedEntities[i - spriteCount];
+                const Sprite& sprite = packedSprites.template get<Sprite>(ent);
+                const PackedTransform2D& t = packedSprites.template get<PackedTransform2D>(ent);
+
+                emit(i, sprite.vertices, t.matrix(), t.get_z_index(), sprite_texture(sprite));
+                quads[i] = {sprite_texture(sprite), t.get_z_index(), false};
+            }
+        }
+    });
+
+    parallel_for(textCount, RENDERER2D_TEXT_GRAIN_SIZE, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            Entity ent = textEntities[i];
+            const Text& text = textObjects.template get<Text>(ent);
+            Transform2D& t = textObjects.template get<Transform2D>(ent);
+
+            const Affine2D transform = Affine2D::from_matrix4(t.matrix());
+            const float zIndex = t.get_z_index();
+            for (size_t q = 0; q < text.quad_count(); q++) {
+                emit(textOffsets[i] + q, text.vertices() + q * 4, transform, zIndex,
+                     text.quad_texture(q));
+                quads[textOffsets[i] + q] = {text.quad_texture(q), zIndex, text.is_sdf()};
+            }
+        }
+    });
+
+    if (ctx.instancing) {
+        // A run is sorted as a whole against other draws, so a z index change breaks it
+        // as well as a texture or shader change.
+        // Bindless instances carry their texture, so the draw has none.
+        auto pipeline = renderer.default_instanced_pipeline().handle();
+        auto sdfPipeline = renderer.default_sdf_instanced_pipeline().handle();
+        size_t first = 0;
+        while (first < quadCount) {
+            Texture::TextureHandle texture = bindless ? nullptr : quads[first].texture;
+            bool sdf = quads[first].sdf;
+            float zIndex = quads[first].zIndex;
+
+            size_t last = first + 1;
+            while (last < quadCount && quads[last].sdf == sdf && quads[last].zIndex == zIndex &&
+                   (bindless || quads[last].texture == texture)) {
+                last++;
+            }
+
+            renderer.draw_instanced(instances.data() + first, static_cast<unsigned>(last - first),
+                                    viewMatrix, texture, sdf ? sdfPipeline : pipeline);
+            first = last;
+        }
+        return;
+    }
+
+    auto pipeline = renderer.default_batch_pipeline().handle();
+    auto sdfPipeline = renderer.default_sdf_pipeline().handle();
+    size_t first = 0;
+    while (first < quadCount) {
+        const Renderer2DContext::BatchQuad& batch = quads[first];
+
+        size_t last = first + 1;
+        while (last < quadCount && quads[last].texture == batch.texture &&
+               quads[last].zIndex == batch.zIndex && quads[last].sdf == batch.sdf) {
+            last++;
+        }
+
+        // Vertices are already in world space, only the z index is left
+        renderer.draw_quads(vertexAllocation.vertexBuffer,
+                            vertexAllocation.first_vertex() + static_cast<unsigned>(first * 4),
+                            static_cast<unsigned>(last - first),
+                            Affine2D{}.to_matrix4(batch.zIndex), viewMatrix, batch.texture,
+                            batch.sdf ? sdfPipeline : pipeline);
+        first = last;
+    }
+}
+
+} // namespace
+
 void renderer_2d(float, World& world) {
     Rendering::Renderer& renderer = *Rendering::Renderer::instance();
 
     auto sprites = world.registry().group<Sprite>(entt::get<Transform2D>);
     auto textObjects = world.registry().group<Text>(entt::get<Transform2D>);
+    auto packedSprites = world.registry().view<Sprite, PackedTransform2D>();
+
+    size_t glyphCount = 0;
+    for (Entity ent : textObjects) {
+        glyphCount += textObjects.get<Text>(ent).quad_count();
+    }
 
-    unsigned vertexCount = (sprites.size() + textObjects.size()) * 4;
+    unsigned vertexCount = (sprites.size() + glyphCount + packedSprites.size_hint()) * 4;
     if (vertexCount <= 0) { // Nothing to draw
         return;
     }
@@ -26,24 +217,30 @@ void renderer_2d(float, World& world) {
         ctx = &world.ctx_set<Renderer2DContext>();
     }
 
-    auto& vbuf = ctx->spriteVertexBuffer;
-    if (vertexCount > vbuf.size()) {
-        vbuf.reallocate(vertexCount + 16);
-    }
-
-    // Check if the vertices required take up less than 50% of the vertex buffer
-    // If so reallocate to save memory
-    if (vbuf.size() > 32 && vertexCount < vbuf.size() / 2) {
-        vbuf.reallocate(vertexCount + 16);
-    }
-
     Entity camera = camera2d_get_current(world);
     Transform2D viewTransform;
     if (camera != NullEntity) {
         viewTransform = camera2d_get_transformation(camera);
     }
 
+    const Matrix4& viewMatrix = viewTransform.matrix();
+
+    if (ctx->batching) {
+        render_batched(*ctx, sprites, textObjects, packedSprites, viewMatrix);
+        return;
+    }
+
+    Rendering::Renderer::TransientAllocation allocation =
+        renderer.allocate_transient(vertexCount * sizeof(Vertex));
+    Vertex* vertices = static_cast<Vertex*>(allocation.data);
+    if (!vertices) {
+        return;
+    }
+
+    void* vertexBuffer = allocation.vertexBuffer;
+    const unsigned firstVertex = allocation.first_vertex();
     auto pipeline = renderer.default_pipeline().handle();
+    auto sdfPipeline = renderer.default_sdf_pipeline().handle();
     unsigned nextVertex = 0;
     for (Entity ent : sprites) {
         Sprite& sprite = sprites.get<Sprite>(ent);
@@ -53,10 +250,26 @@ void renderer_2d(float, World& world) {
         if (sprite.texture)
             tex = sprite.texture->handle();
 
-        vbuf.update(sprite.vertices, nextVertex, 4);
+        std::copy(sprite.vertices, sprite.vertices + 4, vertices + nextVertex);
 
-        renderer.draw(vbuf.handle(), nextVertex, 4, t.matrix(),
-                      viewTransform.matrix(), tex, pipeline);
+        renderer.draw(vertexBuffer, firstVertex + nextVertex, 4, t.matrix(), viewMatrix, tex,
+                      pipeline);
+        nextVertex += 4;
+    }
+
+    // Matrices were rebuilt by Systems::transform_2d, reading them does not lock
+    for (Entity ent : packedSprites) {
+        Sprite& sprite = packedSprites.get<Sprite>(ent);
+        PackedTransform2D& t = packedSprites.get<PackedTransform2D>(ent);
+
+        Texture::TextureHandle tex = nullptr;
+        if (sprite.texture)
+            tex = sprite.texture->handle();
+
+        std::copy(sprite.vertices, sprite.vertices + 4, vertices + nextVertex);
+
+        renderer.draw(vertexBuffer, firstVertex + nextVertex, 4,
+                      t.matrix().to_matrix4(t.get_z_index()), viewMatrix, tex, pipeline);
         nextVertex += 4;
     }
 
@@ -64,10 +277,23 @@ void renderer_2d(float, World& world) {
         Text& text = textObjects.get<Text>(ent);
         Transform2D& t = textObjects.get<Transform2D>(ent);
 
-        vbuf.update(text.vertices(), nextVertex, 4);
-        renderer.draw(vbuf.handle(), nextVertex, 4, t.matrix(), viewTransform.matrix(),
-                      text.tex().handle(), pipeline);
-        nextVertex += 4;
+        const unsigned quadCount = static_cast<unsigned>(text.quad_count());
+        if (!quadCount) {
+            continue;
+        }
+
+        std::copy(text.vertices(), text.vertices() + quadCount * 4, vertices + nextVertex);
+        for (unsigned q = 0; q < quadCount; q++) {
+            if (text.is_sdf()) {
+                // The SDF pipeline draws triangle lists
+                renderer.draw_quads(vertexBuffer, firstVertex + nextVertex, 1, t.matrix(),
+                                    viewMatrix, text.quad_texture(q), sdfPipeline);
+            } else {
+                renderer.draw(vertexBuffer, firstVertex + nextVertex, 4, t.matrix(), viewMatrix,
+                              text.quad_texture(q), pipeline);
+            }
+            nextVertex += 4;
+        }
     }
 }
 
@@ -0,0 +1,9 @@
+#include <Arclight/Systems/Transform2D.h>
+
+#include <Arclight/Graphics/PackedTransform2D.h>
+
+namespace Arclight::Systems {
+
+void transform_2d(float, World&) { TransformStorage2D::instance().rebuild_dirty(); }
+
+} // namespace Arclight::Systems
@@ -9,6 +9,7 @@
 #include <Arclight/Graphics/Image.h>
 #include <Arclight/Graphics/Text.h>
 #include <Arclight/Graphics/Texture.h>
+#include <Arclight/Graphics/TextureAtlas.h>
 #include <Arclight/Systems/Renderer2D.h>
 #include <Arclight/Systems/StdoutFPSCounter.h>
 
@@ -98,8 +99,10 @@ using Board = std::array<std::array<Entity, BOARD_WIDTH>, BOARD_HEIGHT>;
 
 #define MAX_MOVE_RESETS 15
 
-Texture* blockTexture;
-Texture* boardTexture;
+// Block and board images share one atlas texture
+TextureAtlas* atlas;
+TextureAtlas::Region blockRegion;
+TextureAtlas::Region boardRegion;
 
 Vector2f boardScreenPos;
 
@@ -167,10 +170,10 @@ Entity ConstructBlockSprite(World& world, int block, int x, int y) {
     assert(block > 0 && block < 8);
 
     // Create sprite object with block texture
-    Sprite spr = create_sprite({BLOCK_SIZE, BLOCK_SIZE}, Rectf(Vector2f{1.0f, 1.0f}), blockColours[block].AsFloat());
+    Sprite spr = create_sprite({BLOCK_SIZE, BLOCK_SIZE}, blockRegion.textureCoordinates, blockColours[block].AsFloat());
     Transform2D transform;
 
-    spr.texture = blockTexture;
+    spr.texture = blockRegion.texture;
     transform.set_position(BlockToPixelCoords({x, y}));
     transform.set_z_index(0);
 
@@ -314,9 +317,10 @@ void BoardInit(float, World& world) {
     boardScreenPos.y = BLOCK_SIZE;
 
     Sprite boardSprite =
-        create_sprite({(BOARD_WIDTH + 2) * BLOCK_SIZE, (BOARD_HEIGHT + 1) * BLOCK_SIZE});
+        create_sprite({(BOARD_WIDTH + 2) * BLOCK_SIZE, (BOARD_HEIGHT + 1) * BLOCK_SIZE},
+                      boardRegion.textureCoordinates);
     Transform2D boardTransform;
-    boardSprite.texture = boardTexture;
+    boardSprite.texture = boardRegion.texture;
     boardTransform.set_position(boardScreenPos - Vector2f{BLOCK_SIZE, 0});
     boardTransform.set_z_index(.1f);
 
@@ -710,9 +714,11 @@ ARCLIGHT_GAME_INIT() {
     assert(blockImage.get());
     assert(boardImage.get());
 
-    // Create texture from block image resource
-    blockTexture = new Texture(*blockImage);
-    boardTexture = new Texture(*boardImage);
+    // Pack the block and board images into an atlas
+    atlas = new TextureAtlas({1024, 1024});
+    blockRegion = atlas->add(*blockImage);
+    boardRegion = atlas->add(*boardImage);
+    atlas->flush();
 
     StdoutFPSCounter fpsCounter;
 
@@ -730,5 +736,5 @@ ARCLIGHT_GAME_INIT() {
 
     app.run();
 
-    delete blockTexture;
+    delete atlas;
 }
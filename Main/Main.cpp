@@ -39,16 +39,24 @@ int wmain(int argc, wchar_t** argv) {
 int main(int argc, char** argv) {
 #endif
 
+    // The game directory names the game (see Platform::application_name()),
+    // enter it before the renderer loads its caches
+#if defined(ARCLIGHT_PLATFORM_UNIX) && !defined(ARCLIGHT_PLATFORM_WASM)
+    if (argc >= 2) {
+        chdir(argv[1]);
+    }
+#elif defined(ARCLIGHT_PLATFORM_WINDOWS) && !defined(ARCLIGHT_SINGLE_EXECUTABLE)
+    if (argc >= 2) {
+        SetCurrentDirectoryW(argv[1]);
+    }
+#endif
+
     Platform::Initialize();
     Logger::Debug("Using renderer: {}", Rendering::Renderer::instance()->get_name());
 
 #if defined(ARCLIGHT_PLATFORM_WASM)
     void (*InitFunc)(void) = game_init;
 #elif defined(ARCLIGHT_PLATFORM_UNIX)
-    if (argc >= 2) {
-        chdir(argv[1]);
-    }
-
     char cwd[4096];
     getcwd(cwd, 4096);
 
@@ -71,10 +79,6 @@ int main(int argc, char** argv) {
 #elif defined(ARCLIGHT_PLATFORM_WINDOWS)
 
 #ifndef ARCLIGHT_SINGLE_EXECUTABLE
-    if (argc >= 2) {
-        SetCurrentDirectoryW(argv[1]);
-    }
-
     wchar_t cwd[_MAX_PATH];
     DWORD cwdLen; 
     if (cwdLen = GetCurrentDirectoryW(_MAX_PATH, cwd); cwdLen > _MAX_PATH || cwdLen == 0) {
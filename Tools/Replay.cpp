@@ -0,0 +1,149 @@
+// Render capture replay
+//
+// Replays a capture recorded with ARCLIGHT_RENDER_CAPTURE=<file> against the renderer of
+// this build and reports the CPU cost of submitting and rendering each frame.
+// Every loop replays the whole capture, recreating its resources.
+//
+// Usage: arclight-replay <capture> [loops] [--headless]
+//     --headless  Replay with the software renderer without a window
+//                 (needs USE_SOFTWARE_RENDERER)
+
+#include <Arclight/Core/Logger.h>
+#include <Arclight/Core/ThreadPool.h>
+#include <Arclight/Graphics/Rendering/RenderCapture.h>
+#include <Arclight/Graphics/Rendering/Renderer.h>
+#include <Arclight/Platform/Platform.h>
+
+#ifdef ARCLIGHT_SOFTWARE_RENDERER
+#include <Rendering/Software/SoftwareRenderer.h>
+#endif
+
+#include <fmt/core.h>
+
+#include <SDL.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace Arclight;
+using namespace Arclight::Rendering;
+
+static void report(const char* name, std::vector<double>& times) {
+    if (times.empty()) {
+        return;
+    }
+
+    std::sort(times.begin(), times.end());
+
+    double total = 0;
+    for (double time : times) {
+        total += time;
+    }
+
+    fmt::print("{:<8} mean: {:>9.3f} ms  median: {:>9.3f} ms  min: {:>9.3f} ms  "
+               "p99: {:>9.3f} ms  max: {:>9.3f} ms\n",
+               name, total / times.size(), times[times.size() / 2], times.front(),
+               times[std::min(times.size() - 1, times.size() * 99 / 100)], times.back());
+}
+
+int main(int argc, char** argv) {
+    const char* capturePath = nullptr;
+    unsigned loops = 10;
+    bool headless = false;
+
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--headless")) {
+            headless = true;
+        } else if (!capturePath) {
+            capturePath = argv[i];
+        } else {
+            loops = std::max(1ul, std::strtoul(argv[i], nullptr, 10));
+        }
+    }
+
+    if (!capturePath) {
+        fmt::print("Usage: {} <capture> [loops] [--headless]\n", argv[0]);
+        return 1;
+    }
+
+    // The replay would capture itself
+#ifdef ARCLIGHT_PLATFORM_WINDOWS
+    _putenv("ARCLIGHT_RENDER_CAPTURE=");
+#else
+    unsetenv("ARCLIGHT_RENDER_CAPTURE");
+#endif
+
+    ThreadPool pool;
+
+#ifdef ARCLIGHT_SOFTWARE_RENDERER
+    std::unique_ptr<SoftwareRenderer> softwareRenderer;
+#endif
+
+    if (headless) {
+#ifdef ARCLIGHT_SOFTWARE_RENDERER
+        softwareRenderer = std::make_unique<SoftwareRenderer>();
+        softwareRenderer->initialize(nullptr);
+        // Captures start with the size of their window, this is for those without one
+        softwareRenderer->resize_viewport({1280, 720});
+#else
+        fmt::print("--headless needs the software renderer (USE_SOFTWARE_RENDERER)\n");
+        return 1;
+#endif
+    } else {
+        Platform::Initialize();
+    }
+
+    Renderer& renderer = *Renderer::instance();
+
+    // Destroyed before the renderer
+    {
+        CaptureReplay replay(renderer);
+        if (!replay.load(capturePath)) {
+            return 2;
+        }
+
+        fmt::print("{}: {} frames captured with {}, replaying with {}, {} loops\n", capturePath,
+                   replay.frame_count(), replay.captured_renderer(), renderer.get_name(), loops);
+
+        // The first frame creates and uploads the resources of the capture, keep it separate
+        std::vector<double> firstFrames;
+        std::vector<double> frames;
+        bool quit = false;
+        for (unsigned loop = 0; loop < loops && !quit; loop++) {
+            for (unsigned frame = 0; frame < replay.frame_count() && !quit; frame++) {
+                const auto start = std::chrono::steady_clock::now();
+                if (!replay.replay_frame(frame)) {
+                    Logger::Error("Failed to replay frame {}", frame);
+                    return 2;
+                }
+                const auto end = std::chrono::steady_clock::now();
+
+                const double ms = std::chrono::duration<double, std::milli>(end - start).count();
+                (frame ? frames : firstFrames).push_back(ms);
+
+                if (!headless) {
+                    SDL_Event event;
+                    while (SDL_PollEvent(&event)) {
+                        quit |= event.type == SDL_QUIT;
+                    }
+                }
+            }
+
+            replay.reset();
+        }
+
+        report("first", firstFrames);
+        report("frames", frames);
+    }
+
+    if (!headless) {
+        Platform::Cleanup();
+    }
+
+    return 0;
+}
@@ -24,25 +24,51 @@ def dump_shader_file(file, name: str) -> str:
 if __name__ == "__main__":
     subprocess.run(["glslc", path.join(arclight_root, "Data/shaders/default_vulkan.vert"), "-o", path.join(arclight_root, "Build/default_vert.spv")], check=True)
     subprocess.run(["glslc", path.join(arclight_root, "Data/shaders/default_vulkan.frag"), "-o", path.join(arclight_root, "Build/default_frag.spv")], check=True)
+    subprocess.run(["glslc", path.join(arclight_root, "Data/shaders/instanced_vulkan.vert"), "-o", path.join(arclight_root, "Build/instanced_vert.spv")], check=True)
+    subprocess.run(["glslc", path.join(arclight_root, "Data/shaders/sdf_vulkan.frag"), "-o", path.join(arclight_root, "Build/sdf_frag.spv")], check=True)
+    subprocess.run(["glslc", path.join(arclight_root, "Data/shaders/bindless_vulkan.vert"), "-o", path.join(arclight_root, "Build/bindless_vert.spv")], check=True)
+    subprocess.run(["glslc", path.join(arclight_root, "Data/shaders/bindless_instanced_vulkan.vert"), "-o", path.join(arclight_root, "Build/bindless_instanced_vert.spv")], check=True)
+    subprocess.run(["glslc", path.join(arclight_root, "Data/shaders/bindless_vulkan.frag"), "-o", path.join(arclight_root, "Build/bindless_frag.spv")], check=True)
+    subprocess.run(["glslc", path.join(arclight_root, "Data/shaders/bindless_sdf_vulkan.frag"), "-o", path.join(arclight_root, "Build/bindless_sdf_frag.spv")], check=True)
+
+    # Reject modules the driver would, before they are embedded in the engine
+    for spv in ["default_vert", "default_frag", "instanced_vert", "sdf_frag", "bindless_vert", "bindless_instanced_vert", "bindless_frag", "bindless_sdf_frag"]:
+        subprocess.run(["spirv-val", "--target-env", "vulkan1.0", path.join(arclight_root, f"Build/{spv}.spv")], check=True)
     
     frag_gl = open(path.join(arclight_root, "Data/shaders/default_gles.frag"), "rb")
     vert_gl = open(path.join(arclight_root, "Data/shaders/default_gles.vert"), "rb")
+    instanced_vert_gl = open(path.join(arclight_root, "Data/shaders/instanced_gles.vert"), "rb")
+    sdf_frag_gl = open(path.join(arclight_root, "Data/shaders/sdf_gles.frag"), "rb")
     output_gl = open(path.join(arclight_root, "Engine/Rendering/OpenGL/DefaultShaderSource.h"), "w")
 
-    gl_header_file = dump_shader_file(frag_gl, "defaultFragmentShader") + "\n" + dump_shader_file(vert_gl, "defaultVertexShader")
+    gl_header_file = dump_shader_file(frag_gl, "defaultFragmentShader") + "\n" + dump_shader_file(vert_gl, "defaultVertexShader") + "\n" + dump_shader_file(instanced_vert_gl, "defaultInstancedVertexShader") + "\n" + dump_shader_file(sdf_frag_gl, "defaultSDFFragmentShader")
     output_gl.write(gl_header_file)
 
     frag_gl.close()
     vert_gl.close()
+    instanced_vert_gl.close()
+    sdf_frag_gl.close()
     output_gl.close()
 
     frag_spv = open(path.join(arclight_root, "Build/default_frag.spv"), "rb")
     vert_spv = open(path.join(arclight_root, "Build/default_vert.spv"), "rb")
+    instanced_vert_spv = open(path.join(arclight_root, "Build/instanced_vert.spv"), "rb")
+    sdf_frag_spv = open(path.join(arclight_root, "Build/sdf_frag.spv"), "rb")
+    bindless_vert_spv = open(path.join(arclight_root, "Build/bindless_vert.spv"), "rb")
+    bindless_instanced_vert_spv = open(path.join(arclight_root, "Build/bindless_instanced_vert.spv"), "rb")
+    bindless_frag_spv = open(path.join(arclight_root, "Build/bindless_frag.spv"), "rb")
+    bindless_sdf_frag_spv = open(path.join(arclight_root, "Build/bindless_sdf_frag.spv"), "rb")
     output_spv = open(path.join(arclight_root, "Engine/Rendering/Vulkan/DefaultShaderBytecode.h"), "w")
 
-    vulkan_header_file = dump_shader_file(frag_spv, "defaultFragmentShader") + "\n" + dump_shader_file(vert_spv, "defaultVertexShader")
+    vulkan_header_file = dump_shader_file(frag_spv, "defaultFragmentShader") + "\n" + dump_shader_file(vert_spv, "defaultVertexShader") + "\n" + dump_shader_file(instanced_vert_spv, "defaultInstancedVertexShader") + "\n" + dump_shader_file(sdf_frag_spv, "defaultSDFFragmentShader") + "\n" + dump_shader_file(bindless_vert_spv, "bindlessVertexShader") + "\n" + dump_shader_file(bindless_instanced_vert_spv, "bindlessInstancedVertexShader") + "\n" + dump_shader_file(bindless_frag_spv, "bindlessFragmentShader") + "\n" + dump_shader_file(bindless_sdf_frag_spv, "bindlessSDFFragmentShader")
     output_spv.write(vulkan_header_file)
 
     frag_spv.close()
     vert_spv.close()
+    instanced_vert_spv.close()
+    sdf_frag_spv.close()
+    bindless_vert_spv.close()
+    bindless_instanced_vert_spv.close()
+    bindless_frag_spv.close()
+    bindless_sdf_frag_spv.close()
     output_spv.close()